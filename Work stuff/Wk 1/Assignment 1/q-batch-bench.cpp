@@ -0,0 +1,116 @@
+/*!*************************************************************************
+****
+\file q-batch-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Benchmark of the batch mode on thousands of small files.
+ The function include:
+- main()
+Writes a directory of small log-like files, analyzes them one at a time
+with q() and then with q_batch() on 1, 2, 4, ... threads, checks that every
+statistics file comes out the same and prints files and MB per second
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator> // std::istreambuf_iterator
+#include <string>
+#include <thread>
+#include <vector>
+#include "q.hpp"
+#include "q-batch.hpp"
+
+namespace {
+
+  char const BENCH_DIR[] {"q-batch-bench-tmp"};
+  std::size_t const NUM_FILES {4000};
+  std::size_t const FILE_SIZE {2048};
+
+  std::string read_file(std::string const& filename) {
+    std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+    return std::string((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  }
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // log-like text of about size bytes, different for every seed
+  std::string make_text(std::size_t size, unsigned seed) {
+    static char const *pieces[] = {
+      "Hello.", "How", "are", "you?", "I", "am", "4", "years", "old.", "IP",
+      "address", "128.4.0.46", "ERROR", "code=503", "user42", "(retry)", "\n", "\t"
+    };
+    std::string text;
+    while (text.size() < size) {
+      seed = seed * 1103515245u + 12345u;
+      text += pieces[(seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))];
+      text += ' ';
+    }
+    return text;
+  }
+
+  std::vector<std::string> read_outputs(std::vector<std::string> const& outputs) {
+    std::vector<std::string> contents;
+    for (std::string const& output : outputs) {
+      contents.push_back(read_file(output));
+    }
+    return contents;
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::filesystem::remove_all(BENCH_DIR);
+  std::filesystem::create_directory(BENCH_DIR);
+  std::vector<std::string> inputs;
+  std::size_t bytes {0};
+  for (std::size_t i = 0; i < NUM_FILES; i++) {
+    std::string name = std::string(BENCH_DIR) + "/log" + std::to_string(100000 + i) + ".txt";
+    std::string text = make_text(FILE_SIZE, static_cast<unsigned>(i));
+    std::ofstream(name, std::ios_base::out | std::ios_base::binary) << text;
+    inputs.push_back(name);
+    bytes += text.size();
+  }
+  inputs = hlp2::batch_inputs(std::vector<std::string> {BENCH_DIR});
+  std::vector<std::string> outputs = hlp2::batch_stats_filenames(inputs);
+  double files = static_cast<double>(inputs.size());
+  double megabytes = static_cast<double>(bytes) / 1e6;
+
+  // one q() per file, what a script calling ./q.out per file does minus
+  // the process start-up
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < inputs.size(); i++) {
+    hlp2::q(inputs[i].c_str(), outputs[i].c_str());
+  }
+  double serial_seconds = seconds_since(start);
+  std::vector<std::string> expected = read_outputs(outputs);
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << inputs.size() << " files of " << FILE_SIZE << " bytes, " << megabytes << " MB\n";
+  std::cout << "                  files/s     MB/s\n";
+  std::cout << "q() per file   " << std::setw(10) << files / serial_seconds
+            << std::setw(9) << megabytes / serial_seconds << "\n";
+
+  unsigned cores = std::thread::hardware_concurrency();
+  cores = cores ? cores : 1;
+  unsigned max_threads = cores < 4 ? 4 : cores;
+  for (unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    hlp2::q_batch(inputs, (std::string(BENCH_DIR) + "/summary.txt").c_str(), num_threads);
+    double seconds = seconds_since(start);
+    std::cout << "q_batch " << num_threads << (num_threads > 1 ? " thr " : " thr  ")
+              << std::setw(10) << files / seconds << std::setw(9) << megabytes / seconds
+              << (read_outputs(outputs) == expected ? "   match" : "   DIFFER")
+              << (num_threads > cores ? "   (more threads than cores)" : "") << "\n";
+  }
+  std::filesystem::remove_all(BENCH_DIR);
+}
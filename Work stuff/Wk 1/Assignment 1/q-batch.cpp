@@ -0,0 +1,334 @@
+/*!*************************************************************************
+****
+\file q-batch.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Batch mode of the file statistics for many input files in one process.
+ The function include:
+- batch_inputs()
+Expands a list of files and directories into the sorted list of inputs
+- stats_filename()
+Name of the statistics file written for an input (file1.txt -> file1-stats.txt)
+- batch_stats_filenames()
+Statistics file of every input of a batch, with no name written twice
+- q_batch()
+Analyzes every input on a bounded pool of worker threads, writes each
+statistics file and one aggregated summary
+****************************************************************************
+***/
+#include "q-batch.hpp"
+#include "q-scan.hpp"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <functional> // std::ref, std::cref
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+  std::size_t const READ_BUFFER_SIZE {1 << 16};
+  std::string const STATS_SUFFIX {"-stats.txt"};
+
+  struct BatchResult
+  {
+    hlp2::FileStats stats;
+    bool found;
+  };
+
+  bool ends_with(std::string const& str, std::string const& suffix)
+  {
+    return str.size() >= suffix.size()
+        && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+  }
+
+  // scans one whole file with the block kernel, reusing the worker's buffer
+  bool scan_file(std::string const& filename, std::vector<char>& buffer, hlp2::FileStats& stats)
+  {
+    std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+    if (!input.is_open())
+    {
+      return false;
+    }
+    hlp2::ScanState state {};
+    while (input)
+    {
+      input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      std::streamsize got = input.gcount();
+      if (got <= 0)
+      {
+        break;
+      }
+      hlp2::scan_bytes(state, buffer.data(), static_cast<std::size_t>(got));
+    }
+    hlp2::scan_finish(state);
+    stats = state.stats;
+    return true;
+  }
+
+  // worker loop: claims the next unprocessed input until none are left
+  void batch_worker(std::vector<std::string> const& inputs, std::vector<std::string> const& outputs,
+                    std::atomic<std::size_t>& next, std::vector<BatchResult>& results)
+  {
+    std::vector<char> buffer(READ_BUFFER_SIZE);
+    for (std::size_t i = next++; i < inputs.size(); i = next++)
+    {
+      BatchResult& result = results[i];
+      result.found = scan_file(inputs[i], buffer, result.stats);
+      if (result.found)
+      {
+        // the table goes to memory first: its endl flushes would otherwise
+        // cost a write per line, which dominates on small files
+        std::ostringstream table;
+        hlp2::write_stats(result.stats, hlp2::white_space_count(result.stats),
+                          ("file: " + inputs[i]).c_str(), table);
+        std::ofstream output(outputs[i], std::ios_base::out);
+        if (!output.is_open())
+        {
+          std::cout << "Unable to create " << outputs[i] << "\n";
+          continue;
+        }
+        output << table.str();
+      }
+    }
+  }
+
+  void write_summary(std::vector<std::string> const& inputs, std::vector<BatchResult> const& results,
+                     char const *summary_file)
+  {
+    std::ofstream output(summary_file, std::ios_base::out);
+    if (!output.is_open())
+    {
+      std::cout << "Unable to create " << summary_file << "\n";
+      return;
+    }
+
+    hlp2::FileStats total {};
+    long long total_white_space {0};
+    std::size_t analyzed {0};
+
+    output << "Batch statistics for " << inputs.size() << " files" << std::endl;
+    output << "---------------------------------------------------------------------" << std::endl;
+    output << "File" << std::setw(41) << "Characters" << std::setw(12) << "Words"
+           << std::setw(12) << "Integers" << std::endl;
+    for (std::size_t i = 0; i < inputs.size(); i++)
+    {
+      output << inputs[i];
+      if (!results[i].found)
+      {
+        output << "  (not found)" << std::endl;
+        continue;
+      }
+      hlp2::FileStats const& stats = results[i].stats;
+      long long white_space = hlp2::white_space_count(stats);
+      long long chars = static_cast<long long>(stats.letters + stats.digits + stats.others) + white_space;
+      int pad = 45 - static_cast<int>(inputs[i].size());
+      output << std::setw(pad > 1 ? pad : 1) << chars << std::setw(12) << stats.words
+             << std::setw(12) << stats.int_count << std::endl;
+
+      hlp2::merge_stats(total, stats);
+      total_white_space += white_space;
+      analyzed++;
+    }
+    output << "\n";
+
+    std::string subject = std::to_string(analyzed) + " files";
+    hlp2::write_stats(total, total_white_space, subject.c_str(), output);
+  }
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Expands the command-line paths into the inputs of a batch. A directory
+stands for every regular file directly inside it, except statistics files
+written by an earlier batch; its files are sorted by name so the batch
+order does not depend on the file system. The summary file of the batch is
+never an input, so a summary kept next to the inputs is not read back on
+the next run.
+\param paths
+Files and directories given by the user, in order
+\param summary_file
+Summary file of the batch, left out of the inputs
+\return
+Input files in batch order
+****************************************************************************
+***/
+  std::vector<std::string> batch_inputs(std::vector<std::string> const& paths, std::string const& summary_file)
+  {
+    namespace fs = std::filesystem;
+    std::string summary = summary_file.empty() ? "" : fs::path(summary_file).lexically_normal().string();
+    auto is_summary = [&summary](std::string const& name) {
+      return !summary.empty() && fs::path(name).lexically_normal().string() == summary;
+    };
+    std::vector<std::string> inputs;
+    for (std::string const& path : paths)
+    {
+      std::error_code ec;
+      if (!fs::is_directory(path, ec))
+      {
+        if (!is_summary(path))
+        {
+          inputs.push_back(path);
+        }
+        continue;
+      }
+      std::vector<std::string> files;
+      for (fs::directory_entry const& entry : fs::directory_iterator(path, ec))
+      {
+        std::string name = entry.path().string();
+        if (entry.is_regular_file(ec) && !ends_with(name, STATS_SUFFIX) && !is_summary(name))
+        {
+          files.push_back(name);
+        }
+      }
+      std::sort(files.begin(), files.end());
+      inputs.insert(inputs.end(), files.begin(), files.end());
+    }
+    return inputs;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Builds the statistics file name of an input by replacing its extension with
+"-stats.txt", e.g. file1.txt becomes file1-stats.txt.
+\param input_filename
+Name of the analyzed file
+\return
+Name of its statistics file, in the same directory
+****************************************************************************
+***/
+  std::string stats_filename(std::string const& input_filename)
+  {
+    std::size_t slash = input_filename.find_last_of("/\\");
+    std::size_t dot = input_filename.find_last_of('.');
+    bool has_ext = dot != std::string::npos && dot != 0
+                && (slash == std::string::npos || dot > slash + 1);
+    return (has_ext ? input_filename.substr(0, dot) : input_filename) + STATS_SUFFIX;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Names the statistics file of every input so no two workers ever write the
+same file. The first input (in batch order) that maps to a name keeps it;
+a later one, such as a.log after a.txt or a file listed twice, gets
+"-2", "-3", ... before "-stats.txt", skipping any name another input maps
+to. No output is ever the name of an input either: with inputs a.txt and
+a-stats.txt, a.txt writes a-2-stats.txt rather than truncate a file
+another worker reads. The names only depend on the input list, never on
+scheduling.
+\param input_filenames
+Files of the batch, in batch order
+\return
+Statistics file of each input, all different
+****************************************************************************
+***/
+  std::vector<std::string> batch_stats_filenames(std::vector<std::string> const& input_filenames)
+  {
+    namespace fs = std::filesystem;
+    // ./a.txt and a.txt name the same file
+    auto key = [](std::string const& name) { return fs::path(name).lexically_normal().string(); };
+    std::vector<std::string> outputs;
+    std::set<std::string> natural;
+    std::set<std::string> taken;
+    for (std::string const& input : input_filenames)
+    {
+      outputs.push_back(stats_filename(input));
+      natural.insert(key(outputs.back()));
+      natural.insert(key(input));
+      taken.insert(key(input));
+    }
+
+    for (std::string& output : outputs)
+    {
+      if (taken.insert(key(output)).second)
+      {
+        continue;
+      }
+      std::string stem = output.substr(0, output.size() - STATS_SUFFIX.size());
+      for (int n = 2;; n++)
+      {
+        std::string candidate = stem + "-" + std::to_string(n) + STATS_SUFFIX;
+        if (!natural.count(key(candidate)) && taken.insert(key(candidate)).second)
+        {
+          output = candidate;
+          break;
+        }
+      }
+    }
+    return outputs;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Analyzes many files in one process. A fixed pool of worker threads claims
+the inputs one at a time, so the pool never grows with the number of files
+and small files do not wait behind a large one. Each worker writes the
+statistics file of every input it analyzes, under the names given by
+batch_stats_filenames() before any worker starts, so no two inputs share
+one. The results are kept by input
+position and the summary is written after all workers finish, so the output
+is the same however the files were scheduled.
+\param input_filenames
+Files to analyze, in summary order (see batch_inputs())
+\param summary_file
+Pointer to the filename of the aggregated summary
+\param num_threads
+Number of worker threads; 0 picks the number of hardware threads
+\return
+void
+****************************************************************************
+***/
+  void q_batch(std::vector<std::string> const& input_filenames, char const *summary_file, unsigned num_threads)
+  {
+    if (num_threads == 0)
+    {
+      num_threads = std::thread::hardware_concurrency();
+      num_threads = num_threads ? num_threads : 1;
+    }
+    if (num_threads > input_filenames.size())
+    {
+      num_threads = static_cast<unsigned>(input_filenames.size());
+    }
+
+    std::vector<std::string> outputs = batch_stats_filenames(input_filenames);
+    for (std::size_t i = 0; i < input_filenames.size(); i++)
+    {
+      if (outputs[i] != stats_filename(input_filenames[i]))
+      {
+        std::cout << "Statistics of " << input_filenames[i] << " go to " << outputs[i] << "." << std::endl;
+      }
+    }
+
+    std::vector<BatchResult> results(input_filenames.size(), BatchResult {FileStats {}, false});
+    std::atomic<std::size_t> next {0};
+    JoinedThreads workers;
+    for (unsigned i = 1; i < num_threads; i++)
+    {
+      workers.threads.emplace_back(batch_worker, std::cref(input_filenames), std::cref(outputs), std::ref(next),
+                                   std::ref(results));
+    }
+    batch_worker(input_filenames, outputs, next, results);
+    workers.join();
+
+    for (std::size_t i = 0; i < input_filenames.size(); i++)
+    {
+      if (!results[i].found)
+      {
+        std::cout << "File " << input_filenames[i] << " not found." << std::endl;
+      }
+    }
+    write_summary(input_filenames, results, summary_file);
+  }
+}
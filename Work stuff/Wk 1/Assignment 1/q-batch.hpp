@@ -0,0 +1,38 @@
+/*!*************************************************************************
+****
+\file q-batch.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Batch mode of the file statistics for many input files in one process.
+ The function include:
+- batch_inputs()
+Expands a list of files and directories into the sorted list of inputs
+- stats_filename()
+Name of the statistics file written for an input (file1.txt -> file1-stats.txt)
+- batch_stats_filenames()
+Statistics file of every input of a batch, with no name written twice
+- q_batch()
+Analyzes every input on a bounded pool of worker threads, writes each
+statistics file and one aggregated summary
+****************************************************************************
+***/
+#ifndef Q_BATCH_HPP_
+#define Q_BATCH_HPP_
+#include <string>
+#include <vector>
+#include "q.hpp"
+
+namespace hlp2 {
+  std::vector<std::string> batch_inputs(std::vector<std::string> const& paths,
+                                        std::string const& summary_file = std::string());
+  std::string stats_filename(std::string const& input_filename);
+  std::vector<std::string> batch_stats_filenames(std::vector<std::string> const& input_filenames);
+  void q_batch(std::vector<std::string> const& input_filenames,
+               char const *summary_file, unsigned num_threads = 0);
+}
+#endif
@@ -0,0 +1,179 @@
+/*!*************************************************************************
+****
+\file q-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Micro-benchmark for the character classification of the file statistics.
+ The function include:
+- legacy_scan()
+The original word-at-a-time loop of q() with its temp[1000] digit buffer
+- main()
+Times legacy_scan(), scan_scalar() and scan_bytes() over the same bytes in
+memory, checks that they agree and prints bytes per cycle for each
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "q-scan.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define Q_BENCH_RDTSC
+#endif
+
+namespace {
+
+  // cycles (or nanoseconds when there is no cycle counter)
+  unsigned long long ticks() {
+#if defined(Q_BENCH_RDTSC)
+    return __rdtsc();
+#else
+    return static_cast<unsigned long long>(
+      std::chrono::steady_clock::now().time_since_epoch() / std::chrono::nanoseconds(1));
+#endif
+  }
+
+  // the loop q() used before the block kernel, kept as the baseline
+  hlp2::FileStats legacy_scan(std::string const& text) {
+    hlp2::FileStats stats {};
+    std::istringstream input(text);
+    std::string v;
+    int flag = 0;
+    int otherflag = 0;
+    while (input >> v) {
+      stats.words++;
+      char temp[1000] = {};
+      int tempIndex = 0;
+      for (char letter : v) {
+        if (letter >= 'a' && letter <= 'z') {
+          stats.letter_freq[letter - 97]++;
+          stats.lowercase++;
+          stats.letters++;
+          otherflag = 1;
+        } else if (letter >= 'A' && letter <= 'Z') {
+          stats.letter_freq[letter - 65]++;
+          stats.uppercase++;
+          stats.letters++;
+          otherflag = 1;
+        } else if (letter >= 48 && letter <= 57) {
+          stats.digits++;
+          temp[tempIndex++] = letter;
+          flag = 1;
+        } else {
+          stats.others++;
+          otherflag = 1;
+        }
+        if (flag == 1 && otherflag == 1) {
+          stats.int_sum += std::stoi(temp);
+          for (int z = 0; z < 1000; z++) { temp[z] = 0; }
+          stats.int_count++;
+          flag = 0;
+          otherflag = 0;
+          tempIndex = 0;
+        }
+      }
+      if (flag == 1) {
+        stats.int_sum += std::stoi(temp);
+        stats.int_count++;
+        flag = 0;
+      }
+      otherflag = 0;
+    }
+    return stats;
+  }
+
+  // log-like text: words, mixed case, short numbers, punctuation
+  std::string make_text(std::size_t size) {
+    static char const *pieces[] = {
+      "Hello.", "How", "are", "you?", "I", "am", "4", "years", "old.", "IP",
+      "address", "128.4.0.46", "ERROR", "code=503", "user42", "(retry)", "\n", "\t"
+    };
+    std::string text;
+    text.reserve(size + 32);
+    unsigned seed = 12345;
+    while (text.size() < size) {
+      seed = seed * 1103515245u + 12345u;
+      text += pieces[(seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))];
+      text += ' ';
+    }
+    return text;
+  }
+
+  bool same(hlp2::FileStats const& a, hlp2::FileStats const& b) {
+    for (int i = 0; i < 26; i++) {
+      if (a.letter_freq[i] != b.letter_freq[i]) { return false; }
+    }
+    return a.letters == b.letters && a.lowercase == b.lowercase && a.uppercase == b.uppercase
+        && a.digits == b.digits && a.others == b.others && a.words == b.words
+        && a.int_count == b.int_count && a.int_sum == b.int_sum;
+  }
+
+  template <typename F>
+  double rate(std::string const& text, int reps, F scan, hlp2::FileStats& out) {
+    unsigned long long best = ~0ULL;
+    for (int r = 0; r < reps; r++) {
+      unsigned long long start = ticks();
+      out = scan(text);
+      unsigned long long elapsed = ticks() - start;
+      best = elapsed < best ? elapsed : best;
+    }
+    return static_cast<double>(text.size()) / static_cast<double>(best ? best : 1);
+  }
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]) {
+  // argv[1]: optional text file to scan instead of generated text
+  std::string text;
+  if (argc > 1) {
+    std::ifstream ifs(argv[1], std::ios_base::in | std::ios_base::binary);
+    if (!ifs) {
+      std::cout << "File " << argv[1] << " not found." << std::endl;
+      return 0;
+    }
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    text = oss.str();
+  } else {
+    text = make_text(std::size_t {64} << 20);
+  }
+
+  int const reps {5};
+  hlp2::FileStats legacy, scalar, block;
+  double r_legacy = rate(text, reps, legacy_scan, legacy);
+  double r_scalar = rate(text, reps, [](std::string const& t) {
+    hlp2::ScanState state {};
+    hlp2::scan_scalar(state, t.data(), t.size());
+    hlp2::scan_finish(state);
+    return state.stats;
+  }, scalar);
+  double r_block = rate(text, reps, [](std::string const& t) {
+    hlp2::ScanState state {};
+    hlp2::scan_bytes(state, t.data(), t.size());
+    hlp2::scan_finish(state);
+    return state.stats;
+  }, block);
+
+#if defined(Q_BENCH_RDTSC)
+  char const *unit = "bytes/cycle";
+#else
+  char const *unit = "bytes/ns";
+#endif
+  std::cout << "Scanned " << text.size() << " bytes, best of " << reps << " runs\n";
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "legacy loop   " << std::setw(10) << r_legacy << " " << unit << "\n";
+  std::cout << "scan_scalar   " << std::setw(10) << r_scalar << " " << unit << "\n";
+  std::cout << "scan_bytes    " << std::setw(10) << r_block << " " << unit
+            << "  (" << hlp2::scan_kernel_name() << ")\n";
+  std::cout << "results " << ((same(legacy, scalar) && same(scalar, block)) ? "match" : "DIFFER") << "\n";
+}
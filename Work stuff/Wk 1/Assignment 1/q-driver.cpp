@@ -11,15 +11,50 @@ void
 ****************************************************************************
 ***/
 #include <iostream>
+#include <stdexcept> // std::logic_error
+#include <string>   // std::stoi
+#include <vector>
 #include "q.hpp"
+#include "q-batch.hpp"
 
 int main(int argc, char *argv[]) {
   if (argc < 3) {
-    std::cout << "Usage: ./q.out input-text-file input-text-file-stats\n";
+    std::cout << "Usage: ./q.out input-text-file input-text-file-stats [num-threads]\n";
+    std::cout << "       ./q.out -batch summary-file num-threads input-file-or-directory...\n";
+    return 0;
+  }
+
+  // batch mode: every input gets its own *-stats.txt next to it
+  if (std::string(argv[1]) == "-batch") {
+    if (argc < 5) {
+      std::cout << "Usage: ./q.out -batch summary-file num-threads input-file-or-directory...\n";
+      return 0;
+    }
+    int num_threads = 0;
+    try {
+      num_threads = std::stoi(argv[3]);
+    } catch (std::logic_error const&) {   // not a number, or out of range
+      std::cout << "Usage: ./q.out -batch summary-file num-threads input-file-or-directory...\n";
+      return 0;
+    }
+    std::vector<std::string> paths(argv + 4, argv + argc);
+    hlp2::q_batch(hlp2::batch_inputs(paths, argv[2]), argv[2], num_threads < 0 ? 0 : static_cast<unsigned>(num_threads));
     return 0;
   }
 
   // argv[1]: input text file to analyze
   // argv[2]: output text file containing analysis of input text file
-  hlp2::q(argv[1], argv[2]);
+  // argv[3]: optional thread count for the parallel scan (0 = all cores)
+  if (argc > 3) {
+    int num_threads = 0;
+    try {
+      num_threads = std::stoi(argv[3]);
+    } catch (std::logic_error const&) {   // not a number, or out of range
+      std::cout << "Usage: ./q.out input-text-file input-text-file-stats [num-threads]\n";
+      return 0;
+    }
+    hlp2::q_parallel(argv[1], argv[2], num_threads < 0 ? 0 : static_cast<unsigned>(num_threads));
+  } else {
+    hlp2::q(argv[1], argv[2]);
+  }
 }
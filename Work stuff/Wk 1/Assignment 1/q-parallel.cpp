@@ -0,0 +1,155 @@
+/*!*************************************************************************
+****
+\file q-parallel.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Multi-threaded version of the file statistics in q.cpp for very large files.
+ The function include:
+- q_parallel()
+Splits the input file into byte ranges that start on white space, scans
+every range on its own thread with the block kernel of q-scan.cpp and merges
+the counters into one report written by write_stats().
+****************************************************************************
+***/
+#include "q.hpp"
+#include "q-scan.hpp"
+#include <fstream>
+#include <functional> // std::ref
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // ranges smaller than this are not worth a thread of their own
+  std::streamoff const MIN_CHUNK_SIZE {1 << 16};
+  std::size_t const READ_BUFFER_SIZE {1 << 20};
+
+  // scans bytes [begin, end) of the file into stats
+  void scan_range(char const *filename, std::streamoff begin, std::streamoff end, hlp2::FileStats &stats)
+  {
+    std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+    input.seekg(begin);
+    std::vector<char> buffer(READ_BUFFER_SIZE);
+    hlp2::ScanState scanner {};
+    std::streamoff remaining = end - begin;
+    while (remaining > 0 && input)
+    {
+      std::streamsize want = static_cast<std::streamsize>(
+          remaining < static_cast<std::streamoff>(buffer.size()) ? remaining : static_cast<std::streamoff>(buffer.size()));
+      input.read(buffer.data(), want);
+      std::streamsize got = input.gcount();
+      if (got <= 0)
+      {
+        break;
+      }
+      hlp2::scan_bytes(scanner, buffer.data(), static_cast<std::size_t>(got));
+      remaining -= got;
+    }
+    hlp2::scan_finish(scanner);
+    stats = scanner.stats;
+  }
+
+  // moves a nominal split offset forward to the next white space byte so
+  // that no word (and no integer) is cut between two ranges
+  std::streamoff align_to_space(std::ifstream &input, std::streamoff offset, std::streamoff size)
+  {
+    input.clear();
+    input.seekg(offset);
+    char buffer[4096];
+    while (offset < size)
+    {
+      input.read(buffer, sizeof(buffer));
+      std::streamsize got = input.gcount();
+      if (got <= 0)
+      {
+        break;
+      }
+      for (std::streamsize i = 0; i < got; i++)
+      {
+        if (hlp2::is_space(buffer[i]))
+        {
+          return offset + i;
+        }
+      }
+      offset += got;
+    }
+    return size;
+  }
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Analyzes the input file like q() but scans it on several threads. The file
+is cut into byte ranges whose boundaries are moved onto white space, so every
+word and integer is seen whole by exactly one thread. The per-range counters
+are summed in range order and printed by write_stats(), which gives the same
+table as the serial path.
+\param input_filename
+The pointer to the name of the input file containing the text
+\param analysis_file
+Pointer to the output filename to print the text to
+\param num_threads
+Number of threads to use; 0 picks the number of hardware threads
+\return
+void
+****************************************************************************
+***/
+  void q_parallel(char const *input_filename, char const *analysis_file, unsigned num_threads)
+  {
+    std::ifstream input(input_filename, std::ios_base::in | std::ios_base::binary);
+    if (!input.is_open())
+    {
+      std::cout << "File " << input_filename << " not found." << std::endl;
+      return;
+    }
+
+    input.seekg(0, std::ios_base::end);
+    std::streamoff size = input.tellg();
+
+    if (num_threads == 0)
+    {
+      num_threads = std::thread::hardware_concurrency();
+      num_threads = num_threads ? num_threads : 1;
+    }
+    std::streamoff max_chunks = size / MIN_CHUNK_SIZE + 1;
+    if (static_cast<std::streamoff>(num_threads) > max_chunks)
+    {
+      num_threads = static_cast<unsigned>(max_chunks);
+    }
+
+    std::vector<std::streamoff> bounds(num_threads + 1);
+    bounds[0] = 0;
+    bounds[num_threads] = size;
+    for (unsigned i = 1; i < num_threads; i++)
+    {
+      std::streamoff nominal = size / num_threads * i;
+      nominal = nominal < bounds[i - 1] ? bounds[i - 1] : nominal;
+      bounds[i] = align_to_space(input, nominal, size);
+    }
+    input.close();
+
+    std::vector<FileStats> partial(num_threads, FileStats {});
+    JoinedThreads workers;
+    for (unsigned i = 1; i < num_threads; i++)
+    {
+      workers.threads.emplace_back(scan_range, input_filename, bounds[i], bounds[i + 1], std::ref(partial[i]));
+    }
+    scan_range(input_filename, bounds[0], bounds[1], partial[0]);
+    workers.join();
+
+    FileStats stats {};
+    for (FileStats const &part : partial)
+    {
+      merge_stats(stats, part);
+    }
+    write_stats(stats, input_filename, analysis_file);
+  }
+}
@@ -0,0 +1,388 @@
+/*!*************************************************************************
+****
+\file q-scan.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Byte scanners that gather the statistics of q() from raw file bytes.
+ The function include:
+- scan_scalar()
+Reference byte-at-a-time scanner with the same word and integer rules as q()
+- scan_bytes()
+Classifies 64-byte blocks into lowercase/uppercase/digit/space/other bit
+masks, counts every class with popcounts and only steps byte by byte
+through digit runs
+- scan_finish()
+Closes the word that is still open at the end of the input
+- merge_stats()
+Adds the counters of one scan to another
+- scan_kernel_name()
+Name of the kernel compiled into scan_bytes()
+****************************************************************************
+***/
+#include "q-scan.hpp"
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define Q_SCAN_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define Q_SCAN_SSE2
+#endif
+
+namespace
+{
+  inline void flush(hlp2::ScanState& state)
+  {
+    state.stats.int_sum += state.value;
+    state.stats.int_count++;
+    state.value = 0;
+    state.flag = false;
+    state.otherflag = false;
+  }
+
+  inline void end_word(hlp2::ScanState& state)
+  {
+    if (state.flag)
+    {
+      flush(state);
+    }
+    state.otherflag = false;
+    state.in_word = false;
+  }
+
+#if defined(Q_SCAN_AVX2) || defined(Q_SCAN_SSE2)
+  std::size_t const BLOCK_SIZE {64};
+
+  inline int popcount(std::uint64_t bits)
+  {
+    return __builtin_popcountll(bits);
+  }
+
+  // one bit per byte of a 64-byte block for every character class
+  struct BlockMasks
+  {
+    std::uint64_t lower;
+    std::uint64_t upper;
+    std::uint64_t digit;
+    std::uint64_t space;
+  };
+
+#if defined(Q_SCAN_AVX2)
+  // (c - lo) <= (hi - lo) as unsigned bytes
+  inline __m256i in_range(__m256i c, char lo, char hi)
+  {
+    __m256i t = _mm256_sub_epi8(c, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(static_cast<char>(hi - lo))), t);
+  }
+
+  inline std::uint64_t to_mask(__m256i m0, __m256i m1)
+  {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(m0))
+         | static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(m1))) << 32;
+  }
+
+  inline BlockMasks classify(char const *p)
+  {
+    __m256i c0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+    __m256i c1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 32));
+    __m256i blank = _mm256_set1_epi8(' ');
+    BlockMasks m;
+    m.lower = to_mask(in_range(c0, 'a', 'z'), in_range(c1, 'a', 'z'));
+    m.upper = to_mask(in_range(c0, 'A', 'Z'), in_range(c1, 'A', 'Z'));
+    m.digit = to_mask(in_range(c0, '0', '9'), in_range(c1, '0', '9'));
+    m.space = to_mask(_mm256_or_si256(_mm256_cmpeq_epi8(c0, blank), in_range(c0, '\t', '\r')),
+                      _mm256_or_si256(_mm256_cmpeq_epi8(c1, blank), in_range(c1, '\t', '\r')));
+    return m;
+  }
+#else
+  inline __m128i in_range(__m128i c, char lo, char hi)
+  {
+    __m128i t = _mm_sub_epi8(c, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(static_cast<char>(hi - lo))), t);
+  }
+
+  inline BlockMasks classify(char const *p)
+  {
+    BlockMasks m {0, 0, 0, 0};
+    __m128i blank = _mm_set1_epi8(' ');
+    for (int i = 0; i < 4; i++)
+    {
+      __m128i c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 16 * i));
+      int shift = 16 * i;
+      m.lower |= static_cast<std::uint64_t>(_mm_movemask_epi8(in_range(c, 'a', 'z'))) << shift;
+      m.upper |= static_cast<std::uint64_t>(_mm_movemask_epi8(in_range(c, 'A', 'Z'))) << shift;
+      m.digit |= static_cast<std::uint64_t>(_mm_movemask_epi8(in_range(c, '0', '9'))) << shift;
+      m.space |= static_cast<std::uint64_t>(_mm_movemask_epi8(
+                   _mm_or_si128(_mm_cmpeq_epi8(c, blank), in_range(c, '\t', '\r')))) << shift;
+    }
+    return m;
+  }
+#endif
+
+  // bits lo..hi-1 set
+  inline std::uint64_t bit_range(std::size_t lo, std::size_t hi)
+  {
+    std::uint64_t below_hi = hi >= 64 ? ~std::uint64_t {0} : (std::uint64_t {1} << hi) - 1;
+    return below_hi & ~((std::uint64_t {1} << lo) - 1);
+  }
+
+  // Integer rules of q() for one block. Stretches without digits are
+  // skipped with the masks: there only the bytes after the last white space
+  // decide otherflag. Digits and the byte that ends a digit run are stepped
+  // one at a time.
+  void scan_integers(hlp2::ScanState& state, char const *p, BlockMasks const& m)
+  {
+    std::uint64_t word = ~m.space;
+    std::size_t pos = 0;
+    while (pos < BLOCK_SIZE)
+    {
+      if (!state.flag)
+      {
+        std::uint64_t ahead = m.digit & bit_range(pos, BLOCK_SIZE);
+        std::size_t next = ahead ? static_cast<std::size_t>(__builtin_ctzll(ahead)) : BLOCK_SIZE;
+        std::uint64_t span = bit_range(pos, next);
+        std::uint64_t spaces = m.space & span;
+        if (spaces)
+        {
+          int last_space = 63 - __builtin_clzll(spaces);
+          std::uint64_t after = ~((std::uint64_t {2} << last_space) - 1);
+          state.otherflag = (word & span & after) != 0;
+        }
+        else if (word & span)
+        {
+          state.otherflag = true;
+        }
+        pos = next;
+        if (pos == BLOCK_SIZE)
+        {
+          break;
+        }
+      }
+
+      std::uint64_t bit = std::uint64_t {1} << pos;
+      if (m.space & bit)
+      {
+        flush(state);
+      }
+      else if (m.digit & bit)
+      {
+        state.value = state.value * 10 + static_cast<unsigned>(p[pos] - '0');
+        state.flag = true;
+        if (state.otherflag)
+        {
+          flush(state);
+        }
+      }
+      else
+      {
+        // ends the run; the flush also clears otherflag for this byte
+        flush(state);
+      }
+      pos++;
+    }
+  }
+#endif
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Feeds bytes one at a time through the word and integer rules of q(). A
+digit run is added to the integer sum when a non-digit has been seen since
+the last flush or when the word ends, without any temporary buffer.
+\param state
+Running state of the scan
+\param buf
+Pointer to the bytes to scan
+\param len
+Number of bytes to scan
+\return
+void
+****************************************************************************
+***/
+  void scan_scalar(ScanState& state, char const *buf, std::size_t len)
+  {
+    FileStats& stats = state.stats;
+    for (std::size_t i = 0; i < len; i++)
+    {
+      char letter = buf[i];
+      if (is_space(letter))
+      {
+        if (state.in_word)
+        {
+          end_word(state);
+        }
+        continue;
+      }
+      if (!state.in_word)
+      {
+        state.in_word = true;
+        stats.words++;
+      }
+
+      if (letter >= 'a' && letter <= 'z')
+      {
+        stats.letter_freq[letter - 'a']++;
+        stats.lowercase++;
+        stats.letters++;
+        state.otherflag = true;
+      }
+      else if (letter >= 'A' && letter <= 'Z')
+      {
+        stats.letter_freq[letter - 'A']++;
+        stats.uppercase++;
+        stats.letters++;
+        state.otherflag = true;
+      }
+      else if (letter >= '0' && letter <= '9')
+      {
+        stats.digits++;
+        state.value = state.value * 10 + static_cast<unsigned>(letter - '0');
+        state.flag = true;
+      }
+      else
+      {
+        stats.others++;
+        state.otherflag = true;
+      }
+
+      if (state.flag && state.otherflag)
+      {
+        flush(state);
+      }
+    }
+  }
+
+/*!*************************************************************************
+****
+\brief
+Block version of scan_scalar(). Every 64-byte block is turned into one bit
+mask per character class, the class counts and the word count come from
+popcounts, and the letter histogram is built branch-free from four
+interleaved tables. The integer rules only step byte by byte through digit
+runs and jump over the rest of the block with the masks. The tail shorter
+than a block goes through scan_scalar().
+\param state
+Running state of the scan
+\param buf
+Pointer to the bytes to scan
+\param len
+Number of bytes to scan
+\return
+void
+****************************************************************************
+***/
+  void scan_bytes(ScanState& state, char const *buf, std::size_t len)
+  {
+#if defined(Q_SCAN_AVX2) || defined(Q_SCAN_SSE2)
+    FileStats& stats = state.stats;
+    std::uint64_t hist[4][256] = {};
+    std::size_t i = 0;
+    for (; i + BLOCK_SIZE <= len; i += BLOCK_SIZE)
+    {
+      char const *p = buf + i;
+      BlockMasks m = classify(p);
+      std::uint64_t word = ~m.space;
+      std::uint64_t other = word & ~(m.lower | m.upper | m.digit);
+
+      stats.lowercase += popcount(m.lower);
+      stats.uppercase += popcount(m.upper);
+      stats.letters += popcount(m.lower | m.upper);
+      stats.digits += popcount(m.digit);
+      stats.others += popcount(other);
+      stats.words += popcount(word & ~((word << 1) | (state.in_word ? 1u : 0u)));
+
+      // letters fold onto 'a'..'z'; other bytes land in slots never read
+      for (std::size_t k = 0; k < BLOCK_SIZE; k += 4)
+      {
+        hist[0][static_cast<unsigned char>(p[k] | 0x20)]++;
+        hist[1][static_cast<unsigned char>(p[k + 1] | 0x20)]++;
+        hist[2][static_cast<unsigned char>(p[k + 2] | 0x20)]++;
+        hist[3][static_cast<unsigned char>(p[k + 3] | 0x20)]++;
+      }
+
+      scan_integers(state, p, m);
+      state.in_word = (word >> 63) != 0;
+    }
+
+    for (int c = 0; c < 26; c++)
+    {
+      stats.letter_freq[c] += hist[0]['a' + c] + hist[1]['a' + c] + hist[2]['a' + c] + hist[3]['a' + c];
+    }
+    scan_scalar(state, buf + i, len - i);
+#else
+    scan_scalar(state, buf, len);
+#endif
+  }
+
+/*!*************************************************************************
+****
+\brief
+Ends the scan by closing a word that runs up to the end of the input, so a
+trailing digit run is counted.
+\param state
+Running state of the scan
+\return
+void
+****************************************************************************
+***/
+  void scan_finish(ScanState& state)
+  {
+    end_word(state);
+  }
+
+/*!*************************************************************************
+****
+\brief
+Adds the counters of one scan (a byte range or a whole file) to another.
+\param into
+Counters that receive the sum
+\param from
+Counters to add
+\return
+void
+****************************************************************************
+***/
+  void merge_stats(FileStats& into, FileStats const& from)
+  {
+    into.letters += from.letters;
+    into.lowercase += from.lowercase;
+    into.uppercase += from.uppercase;
+    into.digits += from.digits;
+    into.others += from.others;
+    into.words += from.words;
+    for (int i = 0; i < 26; i++)
+    {
+      into.letter_freq[i] += from.letter_freq[i];
+    }
+    into.int_count += from.int_count;
+    into.int_sum += from.int_sum;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Reports which kernel scan_bytes() was compiled with.
+\return
+"avx2", "sse2" or "scalar"
+****************************************************************************
+***/
+  char const* scan_kernel_name()
+  {
+#if defined(Q_SCAN_AVX2)
+    return "avx2";
+#elif defined(Q_SCAN_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+}
@@ -0,0 +1,79 @@
+/*!*************************************************************************
+****
+\file q-scan.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Byte scanners that gather the statistics of q() from raw file bytes.
+ The function include:
+- scan_scalar()
+Reference byte-at-a-time scanner
+- scan_bytes()
+Block kernel that classifies 64 bytes at a time with SSE2/AVX2 when the
+compiler targets them, and falls back to scan_scalar() otherwise
+- scan_finish()
+Closes the word that is still open at the end of the input
+- merge_stats()
+Adds the counters of one scan to another
+- scan_kernel_name()
+Name of the kernel compiled into scan_bytes()
+- is_space()
+White space test shared by the scanners and the range splitter
+- JoinedThreads
+Worker threads that are joined on every way out of a scope
+****************************************************************************
+***/
+#ifndef Q_SCAN_HPP_
+#define Q_SCAN_HPP_
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "q.hpp"
+
+namespace hlp2 {
+  // running state of a scan; a byte range may be fed in any number of pieces
+  struct ScanState {
+    FileStats stats;
+    bool in_word;     // last byte fed was part of a word
+    bool flag;        // digits pending in value
+    bool otherflag;   // non-digit seen since the last flush
+    unsigned long long value;  // integer being built from the pending digits, modulo 2^64
+  };
+
+  // same white space set that operator>> skips in the classic locale
+  inline bool is_space(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+  }
+
+  // Joins its threads when it goes out of scope, so a thread that fails to
+  // start, or an exception on the calling thread, cannot leave a joinable
+  // std::thread behind (its destructor would call std::terminate).
+  class JoinedThreads {
+  public:
+    JoinedThreads() = default;
+    JoinedThreads(JoinedThreads const&) = delete;
+    JoinedThreads& operator=(JoinedThreads const&) = delete;
+    ~JoinedThreads() { join(); }
+
+    void join() {
+      for (std::thread& thread : threads) {
+        if (thread.joinable()) {
+          thread.join();
+        }
+      }
+    }
+
+    std::vector<std::thread> threads;
+  };
+
+  void scan_scalar(ScanState& state, char const *buf, std::size_t len);
+  void scan_bytes(ScanState& state, char const *buf, std::size_t len);
+  void scan_finish(ScanState& state);
+  void merge_stats(FileStats& into, FileStats const& from);
+  char const* scan_kernel_name();
+}
+#endif
@@ -12,12 +12,17 @@ This program analyzes numbers and letters in a file and prints out statitstics i
  The function include:
 - void q()
 Takes in input filename and output filename and analyzed every character
+- long long white_space_count()
+White space reported for a file, derived from its word count
+- void write_stats()
+Prints the statistics table, shared with the parallel and batch paths
 ****************************************************************************
 ***/
 // You must only include the following header files ...
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include "q.hpp"
 
 
 // Important notes:
@@ -37,18 +42,7 @@ namespace hlp2
   {
 
     
-    float letterCnt = 0;
-    float smallCnt = 0;
-    float bigCnt = 0;
-    float digitCnt = 0;
-    float othersCnt = 0;
-    float allCnt = 0;
-    float wordCnt = 0;
-    float resultArr[26] = {};
-    
-    int intCnt = 0;
-    //int ip1, ip2, ip3, ip4;
-    int intSum = 0;
+    FileStats stats {};
 
     int flag = 0;
     int otherflag = 0;
@@ -66,46 +60,39 @@ namespace hlp2
         while(input >> v) //check word by word
         {
 
-            wordCnt++;
+            stats.words++;
 
-            char temp[1000];
-            int tempIndex = 0;
+            unsigned long long number = 0; //digits of the current integer, modulo 2^64
 
             for(char letter : v) //checking the characters in the word
             {
                 
                 if(letter >= 'a' && letter <= 'z')
                 {
-                    resultArr[letter-97]++;
-                    smallCnt++;
-                    letterCnt++;
-                    allCnt++;
+                    stats.letter_freq[letter-97]++;
+                    stats.lowercase++;
+                    stats.letters++;
 
                     otherflag = 1;
                 }
                 else if(letter >= 'A' && letter <= 'Z')
                 {
-                    resultArr[letter-65]++;
-                    bigCnt++;
-                    letterCnt++;
-                    allCnt++;
+                    stats.letter_freq[letter-65]++;
+                    stats.uppercase++;
+                    stats.letters++;
 
                     otherflag = 1;
                 }
                 else if(letter >= 48 && letter <= 57) //if it is a number
                 {
-                    digitCnt++;
-                    allCnt++;
-
+                    stats.digits++;
 
-                    temp[tempIndex] = letter;
-                    tempIndex++;
+                    number = number * 10 + static_cast<unsigned>(letter - '0');
                     flag = 1;
                 }
                 else
                 {
-                    othersCnt++;
-                    allCnt++;
+                    stats.others++;
 
                     otherflag = 1;
 
@@ -113,58 +100,74 @@ namespace hlp2
 
                 if (flag == 1 && otherflag == 1)
                 {
-                    intSum += stoi(temp);
-
-                    for (int z = 0; z < 1000; z++)
-                    {
-                        temp[z] = 0;
-                    }
+                    stats.int_sum += number;
+                    number = 0;
 
-                    intCnt++;
+                    stats.int_count++;
                     flag = 0;
                     otherflag = 0;
-                    tempIndex = 0;
                 }
 
             }
 
             if (flag == 1)
             {
-                
-               intSum += stoi(temp);
-
-                    for (int z = 0; z < 1000; z++)
-                    {
-                        temp[z] = 0;
-                    }
+                stats.int_sum += number;
 
-                    intCnt++;
-                    flag = 0;
-                    otherflag = 0;
-                    tempIndex = 0;
+                stats.int_count++;
+                flag = 0;
             }
            
             otherflag = 0;
-            tempIndex = 0;
 
         }
 
         input.close();
-        
+
+        write_stats(stats, input_filename, analysis_file);
+    }   
+  }
+
+/*!*************************************************************************
+****
+\brief
+Counts the white space of a file the way the expected statistics do, from
+the number of words in it.
+\param stats
+The counters collected from one file
+\return
+Number of white space characters reported for the file
+****************************************************************************
+***/
+  long long white_space_count(FileStats const& stats)
+  {
         //to account for whitespace
-        int whiteSpace = wordCnt-1;
+        long long whiteSpace = static_cast<long long>(stats.words)-1;
 
-        if(wordCnt>5)
+        if(stats.words>5)
         {
             whiteSpace++;
         }
+        return whiteSpace;
+  }
 
-        allCnt += whiteSpace; 
-
-        
-        
-
-
+/*!*************************************************************************
+****
+\brief
+Prints the statistics table for the counters gathered from a file. The
+counters are 64-bit so the table stays exact for files of any size.
+\param stats
+The counters collected by q() or q_parallel()
+\param input_filename
+The pointer to the name of the analyzed file, printed in the table header
+\param analysis_file
+Pointer to the output filename to print the text to
+\return
+void
+****************************************************************************
+***/
+  void write_stats(FileStats const& stats, char const *input_filename, char const *analysis_file)
+  {
         ofstream output (analysis_file, ios_base::out);
         if(!output.is_open())
         {
@@ -172,7 +175,33 @@ namespace hlp2
         }
         else
         {
-            output << "Statistics for file: " << input_filename << endl;
+            write_stats(stats, white_space_count(stats), (string("file: ") + input_filename).c_str(), output);
+        }
+  }
+
+/*!*************************************************************************
+****
+\brief
+Prints the statistics table to an already open stream.
+\param stats
+The counters to print
+\param whiteSpace
+Number of white space characters to report
+\param subject
+What the table describes, printed after "Statistics for "
+\param output
+Stream to print the table to
+\return
+void
+****************************************************************************
+***/
+  void write_stats(FileStats const& stats, long long whiteSpace, char const *subject, ostream& output)
+  {
+        long long allCnt = static_cast<long long>(stats.letters + stats.digits + stats.others) + whiteSpace;
+        double total = static_cast<double>(allCnt);
+        double letterCnt = static_cast<double>(stats.letters);
+
+            output << "Statistics for " << subject << endl;
             output <<"---------------------------------------------------------------------"<<endl;
             output << "\n";
 
@@ -180,45 +209,39 @@ namespace hlp2
             output << "\n";
             output << "Category            How many in file             % of file" << endl;
             output << "---------------------------------------------------------------------" << endl;
-            output << "Letters"<<setw(29)<<letterCnt<<setw(20)<<setprecision(2)<<fixed<<100*letterCnt/allCnt << " %" << endl;
-            output << "White space"<<setw(25)<<whiteSpace<<setw(20)<<setprecision(2)<<fixed<<100*((whiteSpace)/allCnt) <<" %" << endl;
-            output << "Digits"<<setw(30)<<(int)digitCnt<<setw(20)<<setprecision(2)<<fixed<<100*digitCnt/allCnt << " %" <<endl;
-            output << "Other characters"<<setw(20)<<(int)othersCnt<<setw(20)<<setprecision(2)<<fixed<<100*othersCnt/allCnt <<" %" << endl;
+            output << "Letters"<<setw(29)<<stats.letters<<setw(20)<<setprecision(2)<<fixed<<100*letterCnt/total << " %" << endl;
+            output << "White space"<<setw(25)<<whiteSpace<<setw(20)<<setprecision(2)<<fixed<<100*(whiteSpace/total) <<" %" << endl;
+            output << "Digits"<<setw(30)<<stats.digits<<setw(20)<<setprecision(2)<<fixed<<100*static_cast<double>(stats.digits)/total << " %" <<endl;
+            output << "Other characters"<<setw(20)<<stats.others<<setw(20)<<setprecision(2)<<fixed<<100*static_cast<double>(stats.others)/total <<" %" << endl;
             output << "\n";
             output << "\n";
             output << "LETTER STATISTICS" << endl;
             output << "\n";
             output << "Category            How many in file      % of all letters" << endl;
             output << "---------------------------------------------------------------------" << endl;
-            output << "Uppercase"<<setw(27)<<(int)bigCnt<<setw(20)<<setprecision(2)<<fixed<<100*bigCnt/letterCnt<< " %" << endl;
-            output << "Lowercase"<<setw(27)<<(int)smallCnt<<setw(20)<<setprecision(2)<<fixed<<100*smallCnt/letterCnt<< " %" << endl;
+            output << "Uppercase"<<setw(27)<<stats.uppercase<<setw(20)<<setprecision(2)<<fixed<<100*static_cast<double>(stats.uppercase)/letterCnt<< " %" << endl;
+            output << "Lowercase"<<setw(27)<<stats.lowercase<<setw(20)<<setprecision(2)<<fixed<<100*static_cast<double>(stats.lowercase)/letterCnt<< " %" << endl;
             for(int i = 0; i<26; i++)
             { 
     
-                output << (char)(i+97) <<setw(35)<<(int)resultArr[i]<<setw(20)<<100*resultArr[i]/letterCnt << " %" << endl; 
+                output << (char)(i+97) <<setw(35)<<stats.letter_freq[i]<<setw(20)<<100*static_cast<double>(stats.letter_freq[i])/letterCnt << " %" << endl; 
             } 
             output <<"\n"<<endl; 
             output <<"NUMBER ANALYSIS"<<endl; 
             output <<"\n"; 
              
-            output << "Number of integers in file:          "<< intCnt <<endl; 
-            output << "Sum of integers:                     "<<intSum <<endl; 
+            output << "Number of integers in file:          "<< stats.int_count <<endl; 
+            output << "Sum of integers:                     "<<stats.int_sum <<endl; 
 
-            if(intSum>0)
+            if(stats.int_sum>0)
             { 
-                 output << "Average of integers:"<<setw(22)<<setprecision(2)<<fixed<<((float)intSum)/((float)(intCnt)) <<endl; 
+                 output << "Average of integers:"<<setw(22)<<setprecision(2)<<fixed<<static_cast<double>(stats.int_sum)/static_cast<double>(stats.int_count) <<endl; 
             }
             else
             { 
                 output << "Average of integers:"<<setw(21)<<setprecision(2)<<fixed<<0.00 <<endl; 
             } 
             output << "_____________________________________________________________________" <<endl;
-           
-        }  
-
-  
-
-    }   
   }
 }
 
@@ -12,14 +12,46 @@ This program analyzes numbers and letters in a file and prints out statitstics i
  The function include:
 - q()
 Takes in input filename and output filename and analyzed every character
+- q_parallel()
+Same analysis as q() but the file is split into byte ranges that are scanned
+on several threads and merged into one report
+- white_space_count()
+White space reported for a file, derived from its word count
+- write_stats()
+Prints the statistics table shared by all paths
 ****************************************************************************
 ***/
+#ifndef Q_HPP_
+#define Q_HPP_
 #include <iostream>
 #include <iomanip>
 #include <fstream>
 
 
 namespace hlp2 {
+  // counters gathered from one file (or one byte range of a file)
+  struct FileStats {
+    unsigned long long letters;
+    unsigned long long lowercase;
+    unsigned long long uppercase;
+    unsigned long long digits;
+    unsigned long long others;
+    unsigned long long words;
+    unsigned long long letter_freq[26];
+    long long int_count;
+    // digit runs and their sum wrap modulo 2^64 (defined for unsigned)
+    // instead of overflowing, the same way on every path
+    unsigned long long int_sum;
+  };
+
   // provide definition of q here ...
   void q(char const *input_filename, char const *analysis_file);
-}
\ No newline at end of file
+  void q_parallel(char const *input_filename, char const *analysis_file,
+                  unsigned num_threads = 0);
+  long long white_space_count(FileStats const& stats);
+  void write_stats(FileStats const& stats, char const *input_filename,
+                   char const *analysis_file);
+  void write_stats(FileStats const& stats, long long white_space,
+                   char const *subject, std::ostream& output);
+}
+#endif
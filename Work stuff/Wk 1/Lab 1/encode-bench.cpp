@@ -0,0 +1,103 @@
+/*!*************************************************************************
+****
+\file encode-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Round-trip benchmark of the cover text encoder and the decoder.
+ The function include:
+- main()
+Encodes a generated message, decodes the cover text with q() and prints
+the throughput of both sides and whether the message came back exactly
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>   // std::remove
+#include "q.hpp"
+#include "encode.hpp"
+
+namespace {
+
+  char const *TEMP_FILE {"encode-bench-cover.txt"};
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // word list "<prefix>0" .. "<prefix>(n-1)" with its nullptr-terminated view
+  void make_words(char const *prefix, int n, std::vector<std::string>& store,
+                  std::vector<char const*>& words) {
+    for (int i = 0; i < n; i++) {
+      store.push_back(prefix + std::to_string(i));
+    }
+    for (std::string const& w : store) {
+      words.push_back(w.c_str());
+    }
+    words.push_back(nullptr);
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::vector<std::string> keyword_store, filler_store;
+  std::vector<char const*> key_words, filler_words;
+  make_words("key", 16, keyword_store, key_words);
+  make_words("fill", 4096, filler_store, filler_words);
+
+  // message of about 16 MB
+  std::string message;
+  std::string expected;
+  unsigned seed = 7;
+  while (message.size() < (16u << 20)) {
+    seed = seed * 1103515245u + 12345u;
+    std::string word = "m" + std::to_string(seed >> 12);
+    message += word;
+    message += ' ';
+    expected += word;
+    expected += ' ';
+  }
+  expected += '\n';
+
+  hlp2::CoverEncoder encoder(key_words.data(), filler_words.data());
+  if (!encoder.valid()) {
+    std::cout << "invalid word lists\n";
+    return 1;
+  }
+  std::string cover;
+  auto start = std::chrono::steady_clock::now();
+  encoder.encode(message, cover);
+  double encode_time = seconds_since(start);
+
+  {
+    std::ofstream output(TEMP_FILE, std::ios_base::out | std::ios_base::binary);
+    output.write(cover.data(), static_cast<std::streamsize>(cover.size()));
+  }
+
+  // the decoder prints to std::cout; capture it for the comparison
+  std::ostringstream decoded;
+  std::streambuf *old = std::cout.rdbuf(decoded.rdbuf());
+  start = std::chrono::steady_clock::now();
+  hlp2::q(TEMP_FILE, key_words.data());
+  double decode_time = seconds_since(start);
+  std::cout.rdbuf(old);
+  std::remove(TEMP_FILE);
+
+  double message_mb = static_cast<double>(message.size()) / 1e6;
+  double cover_mb = static_cast<double>(cover.size()) / 1e6;
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "message " << message_mb << " MB, cover text " << cover_mb << " MB\n";
+  std::cout << "encode  " << std::setw(8) << cover_mb / encode_time << " MB/s of cover text\n";
+  std::cout << "decode  " << std::setw(8) << cover_mb / decode_time << " MB/s of cover text\n";
+  std::cout << "round trip " << (decoded.str() == expected ? "match" : "DIFFER") << "\n";
+  return decoded.str() == expected ? 0 : 1;
+}
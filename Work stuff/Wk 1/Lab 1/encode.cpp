@@ -0,0 +1,221 @@
+/*!*************************************************************************
+****
+\file encode.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Encoder counterpart of the steganographic decoder q().
+ The function include:
+- CoverEncoder
+Hides a message in cover text made of filler words, so that q() with the
+same keywords prints the message back
+****************************************************************************
+***/
+
+#include "encode.hpp"
+#include <algorithm>     // std::max
+#include <cstring>       // std::memcpy
+#include <unordered_set>
+
+namespace{
+
+std::size_t const WORDS_PER_LINE {12};
+unsigned long long const MAX_GAP {3}; // filler words between two groups
+
+bool is_space(char ch){
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+}
+
+bool has_space(std::string_view word){
+    for(char ch : word){
+        if(is_space(ch)){
+            return true;
+        }
+    }
+    return false;
+}
+
+}
+
+namespace hlp2{
+
+/*!*************************************************************************
+****
+\brief
+Copies the keyword and filler lists and checks that they can produce cover
+text the decoder reads back exactly.
+\param key_words
+The keywords the decoder will be given, terminated by nullptr
+\param filler_words
+Words to pad the cover text with, terminated by nullptr; none may be a keyword
+\param seed
+Seed of the filler choice, the same seed gives the same cover text
+****************************************************************************
+***/
+CoverEncoder::CoverEncoder(char const **key_words, char const **filler_words, unsigned long long seed)
+    : state(seed ? seed : 0x9E3779B97F4A7C15ULL){
+    std::size_t count = 0;
+    for(char const **p = key_words; p && *p; p++){
+        count++;
+    }
+    for(char const **p = filler_words; p && *p; p++){
+        count++;
+    }
+    // reserve first so the views into storage stay valid
+    storage.reserve(count);
+
+    std::unordered_set<std::string_view> keyword_set;
+    for(char const **p = key_words; p && *p; p++){
+        storage.emplace_back(*p);
+        std::string_view word = storage.back();
+        ok = ok && !word.empty() && !has_space(word);
+        keywords.push_back(word);
+        keyword_set.insert(word);
+        longest_keyword = std::max(longest_keyword, word.size());
+    }
+    for(char const **p = filler_words; p && *p; p++){
+        storage.emplace_back(*p);
+        std::string_view word = storage.back();
+        ok = ok && !word.empty() && !has_space(word) && keyword_set.count(word) == 0;
+        fillers.push_back(word);
+        longest_filler = std::max(longest_filler, word.size());
+    }
+    ok = ok && !keywords.empty() && !fillers.empty();
+}
+
+/*!*************************************************************************
+****
+\brief
+Tells if the word lists given to the constructor can be used.
+\return
+true when encode() will produce decodable text
+****************************************************************************
+***/
+bool CoverEncoder::valid() const{
+    return ok;
+}
+
+/*!*************************************************************************
+****
+\brief
+xorshift64* step; plenty for picking filler words and much cheaper than
+the standard engines.
+\return
+Next 64-bit pseudo-random value
+****************************************************************************
+***/
+unsigned long long CoverEncoder::next(){
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+/*!*************************************************************************
+****
+\brief
+Picks a word with a multiply-shift instead of a modulo.
+\param from
+The list to pick from, not empty
+\return
+The picked word
+****************************************************************************
+***/
+std::string_view CoverEncoder::pick(std::vector<std::string_view> const& from){
+    unsigned long long index = ((next() >> 32) * from.size()) >> 32;
+    return from[static_cast<std::size_t>(index)];
+}
+
+/*!*************************************************************************
+****
+\brief
+Copies a word and the separator that follows it into the output buffer.
+Every WORDS_PER_LINE words the separator becomes a line break.
+\param dst
+Where to write, with room for the word and one separator
+\param word
+The word to write
+\param separator
+Character written after the word unless a line break is due
+\return
+Position just past the separator
+****************************************************************************
+***/
+char *CoverEncoder::put(char *dst, std::string_view word, char separator){
+    std::memcpy(dst, word.data(), word.size());
+    dst += word.size();
+    *dst++ = (++line_words % WORDS_PER_LINE == 0) ? '\n' : separator;
+    return dst;
+}
+
+/*!*************************************************************************
+****
+\brief
+Appends the cover text of a message. The output is sized once for the worst
+case, filled through a raw pointer and trimmed at the end, so a message
+costs one allocation at most. The text always starts and ends with filler
+words and ends with a line break.
+\param message
+White space separated words to hide
+\param out
+String the cover text is appended to
+\return
+false (and nothing appended) if the word lists are not valid()
+****************************************************************************
+***/
+bool CoverEncoder::encode(std::string_view message, std::string& out){
+    if(!ok){
+        return false;
+    }
+
+    std::size_t word_count = 0;
+    std::size_t word_bytes = 0;
+    bool in_word = false;
+    for(char ch : message){
+        bool space = is_space(ch);
+        word_count += (!space && !in_word);
+        word_bytes += !space;
+        in_word = !space;
+    }
+
+    std::size_t filler_room = longest_filler + 1;
+    std::size_t bound = word_count * (longest_keyword + 1 + 1 + filler_room * (1 + MAX_GAP))
+                      + word_bytes + filler_room * 2;
+    std::size_t start = out.size();
+    out.resize(start + bound);
+    char *dst = &out[start];
+
+    dst = put(dst, pick(fillers), ' ');
+    std::size_t pos = 0;
+    while(pos < message.size()){
+        while(pos < message.size() && is_space(message[pos])){
+            pos++;
+        }
+        std::size_t begin = pos;
+        while(pos < message.size() && !is_space(message[pos])){
+            pos++;
+        }
+        if(pos == begin){
+            break;
+        }
+        dst = put(dst, pick(keywords), ' ');
+        dst = put(dst, message.substr(begin, pos - begin), ' ');
+        dst = put(dst, pick(fillers), ' ');
+        for(unsigned long long gap = next() & MAX_GAP; gap > 0; gap--){
+            dst = put(dst, pick(fillers), ' ');
+        }
+    }
+    std::string_view last = pick(fillers);
+    std::memcpy(dst, last.data(), last.size());
+    dst += last.size();
+    *dst++ = '\n';
+
+    out.resize(static_cast<std::size_t>(dst - out.data()));
+    return true;
+}
+
+}
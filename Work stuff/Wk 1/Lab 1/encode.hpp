@@ -0,0 +1,56 @@
+/*!*************************************************************************
+****
+\file encode.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Encoder counterpart of the steganographic decoder q().
+ The function include:
+- CoverEncoder
+Hides a message in cover text made of filler words, so that q() with the
+same keywords prints the message back
+****************************************************************************
+***/
+
+#ifndef ENCODE_HPP_
+#define ENCODE_HPP_
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hlp2 {
+// Every message word is written as "keyword word filler"; random runs of
+// filler words go between those groups. Fillers are never keywords, so the
+// decoder only stops on the keywords placed by the encoder.
+class CoverEncoder {
+public:
+  CoverEncoder(char const **key_words, char const **filler_words,
+               unsigned long long seed = 0x9E3779B97F4A7C15ULL);
+
+  // false when the word lists cannot produce decodable text: no keywords,
+  // no fillers, or a filler that is also a keyword or holds white space
+  bool valid() const;
+
+  // appends the cover text of message (white space separated words) to out
+  bool encode(std::string_view message, std::string& out);
+
+private:
+  unsigned long long next();
+  std::string_view pick(std::vector<std::string_view> const& from);
+  char *put(char *dst, std::string_view word, char separator);
+
+  std::vector<std::string> storage;
+  std::vector<std::string_view> keywords;
+  std::vector<std::string_view> fillers;
+  std::size_t longest_keyword = 0;
+  std::size_t longest_filler = 0;
+  std::size_t line_words = 0;
+  unsigned long long state;
+  bool ok = true;
+};
+}
+#endif
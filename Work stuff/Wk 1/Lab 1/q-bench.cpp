@@ -0,0 +1,110 @@
+/*!*************************************************************************
+****
+\file q-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 1: Transitioning from C to C++
+\date 17-10-2026
+\brief
+Benchmark of the keyword matching used by the steganographic decoder.
+ The function include:
+- main()
+Matches the same words against keyword lists of 10, 1k and 100k entries,
+once by comparing every keyword (the original decoder loop) and once
+through a KeywordSet, and prints the time per word for each
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "q.hpp"
+
+namespace {
+
+  // deterministic pseudo-words "w<n>"
+  std::string make_word(unsigned n) {
+    return "w" + std::to_string(n);
+  }
+
+  unsigned next_rand(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+  }
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void run(int num_keywords) {
+    // keywords are w0..w(n-1); words are drawn from twice that range so
+    // about half of them hit a keyword
+    std::vector<std::string> keyword_store;
+    std::vector<char const*> key_words;
+    for (int i = 0; i < num_keywords; i++) {
+      keyword_store.push_back(make_word(static_cast<unsigned>(i)));
+    }
+    for (std::string const& k : keyword_store) {
+      key_words.push_back(k.c_str());
+    }
+    key_words.push_back(nullptr);
+
+    // the linear scan only gets the first linear_words words, which keeps
+    // it to roughly 2e7 string compares
+    std::size_t const num_words {1'000'000};
+    std::size_t linear_words = static_cast<std::size_t>(20'000'000LL / num_keywords);
+    linear_words = linear_words < 1000 ? 1000 : (linear_words > num_words ? num_words : linear_words);
+    std::vector<std::string> words;
+    unsigned seed = 42;
+    for (std::size_t i = 0; i < num_words; i++) {
+      words.push_back(make_word(next_rand(seed) % static_cast<unsigned>(2 * num_keywords)));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    long long linear_hits = 0;
+    for (std::size_t w = 0; w < linear_words; w++) {
+      std::string const& v = words[w];
+      for (int i = 0; key_words[i] != nullptr; i++) {
+        if (key_words[i] == v) {
+          linear_hits++;
+        }
+      }
+    }
+    double linear = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    hlp2::KeywordSet set(key_words.data());
+    double build = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    long long hashed_hits = 0;
+    long long hashed_checked = 0;
+    for (std::size_t w = 0; w < words.size(); w++) {
+      for (int i = set.next_match(words[w], -1); i != -1; i = set.next_match(words[w], i)) {
+        hashed_hits++;
+      }
+      if (w + 1 == linear_words) {
+        hashed_checked = hashed_hits;
+      }
+    }
+    double hashed = seconds_since(start);
+
+    std::cout << std::setw(8) << num_keywords << std::setw(10) << words.size()
+              << std::setw(14) << linear * 1e9 / static_cast<double>(linear_words)
+              << std::setw(14) << hashed * 1e9 / static_cast<double>(words.size())
+              << std::setw(12) << build * 1e3
+              << ((linear_hits == hashed_checked) ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "keywords     words  linear ns/wd  hashed ns/wd    build ms\n";
+  run(10);
+  run(1'000);
+  run(100'000);
+}
@@ -12,18 +12,185 @@ This program decodes and prints a secret message hidden steganographically to st
  The function include:
 - q()
 Takes in the filename with the encrypted message and checks againsts a set of keywords, to reveal the hidden message.
+- KeywordSet
+Keyword list compiled once into a hash index
 ****************************************************************************
 ***/
 
 #include <iostream>
 #include <fstream>
+#include <algorithm> // std::upper_bound
+#include <cstring>   // std::memmove
+#include "q.hpp"
 
 
+namespace{
+
+// Reads white space separated words straight out of a fixed read buffer.
+// The current word is a view into the buffer, so nothing is copied; when the
+// buffer is refilled the current word is moved to its front and stays valid.
+// A failed read leaves the current word unchanged, like operator>> does.
+class TokenReader{
+public:
+    TokenReader(std::istream& input, std::size_t capacity)
+        : is(input), buffer(capacity) {}
+
+    bool read(){
+        if(failed){
+            return false;
+        }
+        // skip white space
+        for(;;){
+            while(pos < end && is_space(buffer[pos])){
+                pos++;
+            }
+            if(pos < end){
+                break;
+            }
+            if(!refill()){
+                at_eof = true;
+                failed = true;
+                return false;
+            }
+        }
+        std::size_t start = pos;
+        for(;;){
+            while(pos < end && !is_space(buffer[pos])){
+                pos++;
+            }
+            if(pos < end){
+                break;
+            }
+            std::size_t moved = start;
+            if(!refill(&moved)){
+                at_eof = true;
+                start = moved;
+                break;
+            }
+            start = moved;
+        }
+        word_begin = start;
+        word_len = pos - start;
+        return true;
+    }
+
+    std::string_view word() const{
+        return std::string_view(buffer.data() + word_begin, word_len);
+    }
+
+    bool eof() const{
+        return at_eof;
+    }
+
+private:
+    static bool is_space(char ch){
+        return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+    }
+
+    // Moves the bytes still needed (the current word, then any partial word
+    // starting at *partial) to the front of the buffer and reads more after
+    // them; the white space around them is dropped, so a long blank run
+    // never piles up. The buffer only grows for words longer than itself.
+    bool refill(std::size_t *partial = nullptr){
+        std::memmove(buffer.data(), buffer.data() + word_begin, word_len);
+        word_begin = 0;
+        end = word_len;
+        if(partial){
+            std::size_t partial_len = pos - *partial;
+            std::memmove(buffer.data() + end, buffer.data() + *partial, partial_len);
+            *partial = end;
+            end += partial_len;
+        }
+        pos = end;
+        if(end == buffer.size()){
+            buffer.resize(buffer.size() * 2);
+        }
+        is.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+        std::streamsize got = is.gcount();
+        end += static_cast<std::size_t>(got);
+        return got > 0;
+    }
+
+    std::istream& is;
+    std::vector<char> buffer;
+    std::size_t pos = 0;
+    std::size_t end = 0;
+    std::size_t word_begin = 0;
+    std::size_t word_len = 0;
+    bool at_eof = false;
+    bool failed = false;
+};
+
+std::size_t const READ_BUFFER_SIZE {1 << 20};
+std::size_t const OUTPUT_BUFFER_SIZE {1 << 16};
+
+}
+
+namespace hlp2{
+
+/*!*************************************************************************
+****
+\brief
+Compiles a null-terminated keyword list into a hash index from each distinct
+keyword to the list positions holding it.
+\param key_words
+The pointer to the keywords, terminated by nullptr (nullptr means no keywords)
+****************************************************************************
+***/
+KeywordSet::KeywordSet(char const **key_words){
+    int count = 0;
+    while(key_words && key_words[count] != nullptr){
+        count++;
+    }
+    // reserve first so the views in positions stay valid
+    words.reserve(count);
+    positions.reserve(count);
+    for(int i = 0; i < count; i++){
+        words.emplace_back(key_words[i]);
+        positions[words.back()].push_back(i);
+    }
+}
+
+/*!*************************************************************************
+****
+\brief
+Finds the next keyword position that matches a word, the way the decoder
+walks the keyword list.
+\param word
+The word to look up
+\param after
+Only positions greater than this are considered; -1 starts at the front
+\return
+Position of the matching keyword, or -1 if there is none
+****************************************************************************
+***/
+int KeywordSet::next_match(std::string_view word, int after) const{
+    auto it = positions.find(word);
+    if(it == positions.end()){
+        return -1;
+    }
+    std::vector<int> const& at = it->second;
+    auto pos = std::upper_bound(at.begin(), at.end(), after);
+    return pos == at.end() ? -1 : *pos;
+}
+
+/*!*************************************************************************
+****
+\brief
+Number of keywords in the list, duplicates included.
+\return
+The keyword count
+****************************************************************************
+***/
+int KeywordSet::size() const{
+    return static_cast<int>(words.size());
+}
 
 /*!*************************************************************************
 ****
 \brief
 Takes in the filename with the encrypted message and checks againsts a set of keywords, to reveal the hidden message.
+The keywords are compiled once into a KeywordSet.
 \param filename
 The pointer to the name of the file containing the encrypted message
 \param key_words
@@ -32,43 +199,52 @@ The pointer to the keywords used to decode the encrypted message
 void
 ****************************************************************************
 ***/
-namespace hlp2{
-
 void q(char const *filename, char const **key_words){
-    std::ifstream ifs(filename, std::ios_base::in);
-   // int twip = 0;
+    q(filename, KeywordSet(key_words));
+}
+
+/*!*************************************************************************
+****
+\brief
+Takes in the filename with the encrypted message and checks againsts a set of keywords, to reveal the hidden message.
+The file is walked as views into a fixed read buffer and the revealed words
+are collected in one output buffer, so memory use does not depend on the
+size of the file.
+\param filename
+The pointer to the name of the file containing the encrypted message
+\param key_words
+The compiled keywords used to decode the encrypted message
+\return
+void
+****************************************************************************
+***/
+void q(char const *filename, KeywordSet const& key_words){
+    std::ifstream ifs(filename, std::ios_base::in | std::ios_base::binary);
     if(!ifs.is_open()){
         std::cout << "File " << filename << " not found." << std::endl;
     }else{
-        std::string v;
+        TokenReader words(ifs, READ_BUFFER_SIZE);
+        std::string message;
+        message.reserve(OUTPUT_BUFFER_SIZE);
         //reads until blank space
-        while(!ifs.eof()){
-            ifs >> v; //v becomes a c++ string with no whitespace chars
-            //ifs >> to a string reads word by word
-            //std::cout << v << std::endl;
-           /* if(twip == 1){
-                    std::cout << v << " ";
-                    twip = 0;
-                }
-           */
-            for(int i = 0; key_words[i] !=nullptr; i++){
-               
-
-                if (key_words[i] == v){
-                //twip = 1;
-                
-                ifs>>v;
-                std::cout << v << " ";
-                ifs>>v;
-                  
-                }
-
-                
-               
-            } 
-        
+        while(!words.eof()){
+            words.read();
+            // every keyword position that matches fires in list order; the
+            // word read after a match is checked against the later positions
+            for(int i = key_words.next_match(words.word(), -1); i != -1; i = key_words.next_match(words.word(), i)){
+                words.read();
+                message.append(words.word());
+                message.push_back(' ');
+                words.read();
+            }
+            // only very long messages are written out before the end
+            if(message.size() >= OUTPUT_BUFFER_SIZE){
+                std::cout.write(message.data(), static_cast<std::streamsize>(message.size()));
+                message.clear();
+            }
         }
-        std::cout << "\n";
+        message.push_back('\n');
+        std::cout.write(message.data(), static_cast<std::streamsize>(message.size()));
     }
 }
 
@@ -12,13 +12,42 @@ This program decodes and prints a secret message hidden steganographically to st
  The function include:
 - q()
 Takes in the filename with the encrypted message and checks againsts a set of keywords, to reveal the hidden message.
+- KeywordSet
+Keyword list compiled once into a hash index so every word is matched in
+expected O(1) instead of against every keyword
 ****************************************************************************
 ***/
 
 #ifndef Q_HPP_
 #define Q_HPP_
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 namespace hlp2 {
+// keyword list compiled for fast lookups; keeps the keyword positions so
+// matches happen in the same order as scanning the null-terminated list;
+// the index keys are views into words, so a KeywordSet is neither copied
+// nor moved
+class KeywordSet {
+public:
+  explicit KeywordSet(char const **key_words);
+  KeywordSet(KeywordSet const&) = delete;
+  KeywordSet& operator=(KeywordSet const&) = delete;
+
+  // position of the first keyword after position after that equals word,
+  // or -1 when there is none
+  int next_match(std::string_view word, int after) const;
+  int size() const;
+
+private:
+  std::vector<std::string> words;
+  std::unordered_map<std::string_view, std::vector<int>> positions;
+};
+
 // declare function q here ...
 void q(char const *filename, char const **key_words);
+void q(char const *filename, KeywordSet const& key_words);
 }
-#endif
\ No newline at end of file
+#endif
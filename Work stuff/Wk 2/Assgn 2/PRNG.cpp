@@ -6,42 +6,184 @@
 /* number and carry packed within the same 32 bit integer.              */
 /************************************************************************/
 
+#include "PRNG.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+  /* Use any pair of non-equal numbers from this list for "a" and "b"
+      18000 18030 18273 18513 18879 19074 19098 19164 19215 19584
+      19599 19950 20088 20508 20544 20664 20814 20970 21153 21243
+      21423 21723 21954 22125 22188 22293 22860 22938 22965 22974
+      23109 23124 23163 23208 23508 23520 23553 23658 23865 24114
+      24219 24660 24699 24864 24948 25023 25308 25443 26004 26088
+      26154 26550 26679 26838 27183 27258 27753 27795 27810 27834
+      27960 28320 28380 28689 28710 28794 28854 28959 28980 29013
+      29379 29889 30135 30345 30459 30714 30903 30963 31059 31083
+  */
+  unsigned const A = 18000, B = 30903;
+  unsigned const SEED_X = 521'288'629;
+  unsigned const SEED_Y = 362'436'069;
+
+  inline unsigned Step(unsigned s, unsigned a) {
+    return a * (s & 65535) + (s >> 16);
+  }
+
+  /* With s = carry*2^16 + x, one step maps s to s * 2^-16 mod (a*2^16 - 1),
+     so n steps are one multiplication by (2^-16)^n; states past that
+     modulus (only possible straight after seeding) take one plain step.  */
+  unsigned JumpOne(unsigned s, unsigned a, unsigned long long steps) {
+    unsigned long long m = static_cast<unsigned long long>(a) * 65536 - 1;
+    if (steps == 0)
+      return s;
+    if (s >= m) {
+      s = Step(s, a);
+      steps--;
+    }
+    if (s == 0 || s == m)          /* fixed points */
+      return s;
+    unsigned long long factor = 1;
+    unsigned long long base = a;   /* 2^-16 mod m is a, since a * 2^16 = m + 1 */
+    while (steps) {
+      if (steps & 1)
+        factor = factor * base % m;
+      base = base * base % m;
+      steps >>= 1;
+    }
+    return static_cast<unsigned>(s * factor % m);
+  }
+
+}
+
 namespace HLP2 {
   namespace Utils {
-  
-      // return a random float >= 0 and < 1
-    static unsigned int SEED_X = 521'288'629;
-    static unsigned int SEED_Y = 362'436'069;
-    
+
+    PRNG::PRNG(unsigned seed1, unsigned seed2) : x(SEED_X), y(SEED_Y) {
+      Seed(seed1, seed2);
+    }
+
+    void PRNG::Seed(unsigned seed1, unsigned seed2) {
+      if (seed1)
+        x = seed1;   /* use default seeds if parameter is 0 */
+      if (seed2)
+        y = seed2;
+    }
+
+    unsigned PRNG::Next() {
+      x = Step(x, A);
+      y = Step(y, B);
+      return ((x << 16) + (y & 65535));
+    }
+
+    int PRNG::Random(int low, int high) {
+      int r1 = static_cast<int>( Next() / 2 - 1 );
+      return r1 % (high - low + 1) + low;
+    }
+
+    /* Lemire's multiply-shift: the high half of Next() * range is the
+       result, and the low half tells whether this draw falls in the short
+       stretch that would bias it. The remainder that sizes that stretch is
+       only computed when the low half is below range, which for small
+       ranges almost never happens, so the usual path has no division. */
+    unsigned PRNG::Below(unsigned range) {
+      unsigned long long m = static_cast<unsigned long long>(Next()) * range;
+      unsigned low = static_cast<unsigned>(m);
+      if (low < range) {
+        unsigned threshold = (0u - range) % range;
+        while (low < threshold) {
+          m = static_cast<unsigned long long>(Next()) * range;
+          low = static_cast<unsigned>(m);
+        }
+      }
+      return static_cast<unsigned>(m >> 32);
+    }
+
+    int PRNG::Between(int low, int high) {
+      unsigned range = static_cast<unsigned>(high) - static_cast<unsigned>(low) + 1;
+      if (range == 0)                /* the whole int range */
+        return static_cast<int>(Next());
+      return static_cast<int>(static_cast<unsigned>(low) + Below(range));
+    }
+
+    void PRNG::Jump(unsigned long long steps) {
+      x = JumpOne(x, A, steps);
+      y = JumpOne(y, B, steps);
+    }
+
+    /* The output is split into LANES equal runs; lane k starts from the
+       state jumped to the start of its run, and all lanes step together in
+       SIMD registers. Each run is the plain sequence, so the whole buffer
+       equals count calls to Next(). */
+    void PRNG::Fill(unsigned *out, std::size_t count) {
+      std::size_t const LANES {8};
+      std::size_t run = count / LANES;
+      std::size_t done = 0;
+#if defined(__SSE2__)
+      if (run >= 64) {
+        alignas(16) unsigned lx[LANES], ly[LANES];
+        PRNG lane(*this);
+        for (std::size_t k = 0; k < LANES; k++) {
+          lx[k] = lane.x;
+          ly[k] = lane.y;
+          lane.Jump(run);
+        }
+        __m128i const low16 = _mm_set1_epi32(65535);
+        __m128i const ma = _mm_set1_epi32(static_cast<int>(A));
+        __m128i const mb = _mm_set1_epi32(static_cast<int>(B));
+        __m128i x0 = _mm_load_si128(reinterpret_cast<__m128i const*>(lx));
+        __m128i x1 = _mm_load_si128(reinterpret_cast<__m128i const*>(lx + 4));
+        __m128i y0 = _mm_load_si128(reinterpret_cast<__m128i const*>(ly));
+        __m128i y1 = _mm_load_si128(reinterpret_cast<__m128i const*>(ly + 4));
+          /* a * (s & 65535) fits in 32 bits: the low and high halves of the
+             16x16 products give it without SSE4's 32-bit multiply */
+        auto step = [low16](__m128i s, __m128i m) {
+          __m128i lo16 = _mm_and_si128(s, low16);
+          __m128i product = _mm_or_si128(_mm_mullo_epi16(lo16, m),
+                                         _mm_slli_epi32(_mm_mulhi_epu16(lo16, m), 16));
+          return _mm_add_epi32(product, _mm_srli_epi32(s, 16));
+        };
+        alignas(16) unsigned value[LANES];
+        for (std::size_t t = 0; t < run; t++) {
+          x0 = step(x0, ma);
+          x1 = step(x1, ma);
+          y0 = step(y0, mb);
+          y1 = step(y1, mb);
+          __m128i v0 = _mm_add_epi32(_mm_slli_epi32(x0, 16), _mm_and_si128(y0, low16));
+          __m128i v1 = _mm_add_epi32(_mm_slli_epi32(x1, 16), _mm_and_si128(y1, low16));
+          _mm_store_si128(reinterpret_cast<__m128i*>(value), v0);
+          _mm_store_si128(reinterpret_cast<__m128i*>(value + 4), v1);
+          for (std::size_t k = 0; k < LANES; k++)
+            out[k * run + t] = value[k];
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(lx), x1);
+        _mm_store_si128(reinterpret_cast<__m128i*>(ly), y1);
+        x = lx[3];                   /* the last lane ends where the runs end */
+        y = ly[3];
+        done = LANES * run;
+      }
+#endif
+      for (; done < count; done++)
+        out[done] = Next();
+    }
+
+    PRNG& DefaultPRNG() {
+      static PRNG generator;
+      return generator;
+    }
+
     unsigned rand() {
-      /* Use any pair of non-equal numbers from this list for "a" and "b"
-          18000 18030 18273 18513 18879 19074 19098 19164 19215 19584
-          19599 19950 20088 20508 20544 20664 20814 20970 21153 21243
-          21423 21723 21954 22125 22188 22293 22860 22938 22965 22974
-          23109 23124 23163 23208 23508 23520 23553 23658 23865 24114
-          24219 24660 24699 24864 24948 25023 25308 25443 26004 26088
-          26154 26550 26679 26838 27183 27258 27753 27795 27810 27834
-          27960 28320 28380 28689 28710 28794 28854 28959 28980 29013
-          29379 29889 30135 30345 30459 30714 30903 30963 31059 31083
-      */
-      static unsigned int a = 18000, b = 30903;
-    
-      SEED_X = a * (SEED_X & 65535) + (SEED_X >> 16);
-      SEED_Y = b * (SEED_Y & 65535) + (SEED_Y >> 16);
-    
-      return ((SEED_X << 16) + (SEED_Y & 65535));
+      return DefaultPRNG().Next();
     }
     
     void srand(unsigned seed1, unsigned seed2) {
-      if (seed1)
-        SEED_X = seed1;   /* use default seeds if parameter is 0 */
-      if (seed2)
-        SEED_Y = seed2;
+      DefaultPRNG().Seed(seed1, seed2);
     }
     
     int Random(int low, int high) {
-      int r1 = static_cast<int>( HLP2::Utils::rand() / 2 - 1 );
-      return r1 % (high - low + 1) + low;
+      return DefaultPRNG().Random(low, high);
     }
   } // namespace Utils
 } // namespace HLP2
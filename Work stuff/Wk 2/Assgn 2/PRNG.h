@@ -2,12 +2,44 @@
 #ifndef PRNG_H
 #define PRNG_H
 ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef> // std::size_t
 
 namespace HLP2 {
   namespace Utils {
     unsigned rand();                 // returns a random 32-bit integer
     void srand(unsigned, unsigned);  // seed the generator
     int Random(int low, int high);   // range
+
+      // The generator behind rand() with its state in the object, so each
+      // thread can own one. A default-constructed PRNG gives the same
+      // sequence as rand() after srand(0, 0); the free functions above use
+      // one shared instance.
+    class PRNG {
+    public:
+        // steps between the substreams handed out by Jump(); the period is
+        // about 2^59, so there are some 2^27 disjoint substreams
+      static unsigned long long const JUMP_STEPS {1ULL << 32};
+
+      explicit PRNG(unsigned seed1 = 0, unsigned seed2 = 0);
+      void Seed(unsigned seed1, unsigned seed2);   // 0 keeps the default seed
+
+      unsigned Next();                    // same as rand()
+      int Random(int low, int high);      // same as Random(), modulo bias and all
+      unsigned Below(unsigned range);     // unbiased in [0, range), range > 0,
+                                          // without the modulo of Random()
+      int Between(int low, int high);     // unbiased in [low, high]
+
+        // advances as if Next() were called steps times, in O(log steps)
+      void Jump(unsigned long long steps = JUMP_STEPS);
+        // the next count values of Next(), written to out
+      void Fill(unsigned *out, std::size_t count);
+
+    private:
+      unsigned x;
+      unsigned y;
+    };
+
+    PRNG& DefaultPRNG();             // the instance used by rand()
   }
 }
 
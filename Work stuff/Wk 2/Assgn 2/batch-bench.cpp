@@ -0,0 +1,109 @@
+/*!*************************************************************************
+****
+\file batch-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of TakeShots() against one TakeShot() call per shot.
+ The function include:
+- main()
+Fires the same random shots, some of them outside the ocean, at two
+copies of a fleet in oceans of several sizes, one shot at a time and in
+batches of several sizes, checks that the results and statistics agree and prints the time
+per shot
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include "ocean.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+
+
+  unsigned next_rand(unsigned long long& state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<unsigned>(state >> 33);
+  }
+
+  void place_fleet(Ocean& ocean, unsigned long long seed) {
+    for (int id = 1; id <= ocean.num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = (next_rand(seed) & 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.x_size));
+        boat.position.y = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.y_size));
+      } while (PlaceBoat(ocean, boat) == bpREJECTED);
+    }
+  }
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void run(int size, std::size_t num_shots, std::size_t batch, OceanLayout layout) {
+    int num_boats = size * size / 40 < 99 ? size * size / 40 : 99;
+      // about 1 shot in 64 falls just outside the ocean
+    std::vector<Point> shots(num_shots);
+    unsigned long long seed = 99;
+    for (Point& p : shots) {
+      unsigned span = static_cast<unsigned>(size + size / 32 + 1);
+      p.x = static_cast<int>(next_rand(seed) % span) - size / 64;
+      p.y = static_cast<int>(next_rand(seed) % span) - size / 64;
+    }
+
+    Ocean *single = CreateOcean(num_boats, size, size, layout);
+    Ocean *batched = CreateOcean(num_boats, size, size, layout);
+    place_fleet(*single, 7);
+    place_fleet(*batched, 7);
+
+    std::vector<ShotResult> single_results(num_shots), batch_results(num_shots);
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < num_shots; i++) {
+      single_results[i] = TakeShot(*single, shots[i]);
+    }
+    double single_time = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < num_shots; i += batch) {
+      std::size_t n = num_shots - i < batch ? num_shots - i : batch;
+      TakeShots(*batched, shots.data() + i, n, batch_results.data() + i);
+    }
+    double batch_time = seconds_since(start);
+
+    ShotStats a = GetShotStats(*single);
+    ShotStats b = GetShotStats(*batched);
+    bool same = single_results == batch_results && a.hits == b.hits && a.misses == b.misses
+             && a.duplicates == b.duplicates && a.sunk == b.sunk;
+
+    std::cout << std::setw(5) << size << "x" << std::left << std::setw(5) << size << std::right
+              << std::setw(10) << (layout == olGRID ? "grid" : "bitboard")
+              << std::setw(10) << num_shots << std::setw(9) << batch
+              << std::setw(12) << single_time * 1e9 / static_cast<double>(num_shots)
+              << std::setw(12) << batch_time * 1e9 / static_cast<double>(num_shots)
+              << (same ? "   match" : "   DIFFER") << "\n";
+    DestroyOcean(single);
+    DestroyOcean(batched);
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "      ocean    layout     shots    batch  single ns   batch ns\n";
+  run(10, 1'000'000, 1 << 10, olGRID);
+  run(100, 4'000'000, 1 << 16, olGRID);
+  run(1'000, 4'000'000, 1 << 16, olGRID);
+  run(4'000, 4'000'000, 1 << 16, olGRID);
+  run(4'000, 4'000'000, 1 << 20, olGRID);
+  run(10'000, 4'000'000, 1 << 16, olGRID);
+  run(1'000, 4'000'000, 1 << 16, olBITBOARD);
+}
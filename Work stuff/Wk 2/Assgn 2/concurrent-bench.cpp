@@ -0,0 +1,143 @@
+/*!*************************************************************************
+****
+\file concurrent-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Scaling benchmark of ConcurrentOcean against one Ocean behind a mutex.
+ The function include:
+- main()
+Fires the same random shots at one large ocean from 1, 2, 4, ... threads,
+up to the number of hardware threads, once through ConcurrentOcean and
+once through TakeShot under a std::mutex, and prints the shot rate of each
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <functional> // std::cref, std::ref
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ocean.h"
+#include "concurrent-ocean.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  int const SIZE {2048};
+  int const NUM_BOATS {99};
+  std::size_t const SHOTS_PER_THREAD {2'000'000};
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  Boat random_boat(PRNG& random, int id) {
+    Boat boat;
+    boat.hits = 0;
+    boat.ID = id;
+    boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+    boat.position.x = random.Between(0, SIZE - 1);
+    boat.position.y = random.Between(0, SIZE - 1);
+    return boat;
+  }
+
+  void wait_for(std::atomic<bool> const& go) {
+    while (!go.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+
+  void concurrent_shooter(ConcurrentOcean& ocean, std::vector<Point> const& shots, unsigned shooter,
+                          std::atomic<bool> const& go) {
+    wait_for(go);
+    for (Point const& shot : shots) {
+      ocean.TakeShot(shot, shooter);
+    }
+  }
+
+  void locked_shooter(Ocean& ocean, std::mutex& lock, std::vector<Point> const& shots,
+                      std::atomic<bool> const& go) {
+    wait_for(go);
+    for (Point const& shot : shots) {
+      std::lock_guard<std::mutex> guard(lock);
+      TakeShot(ocean, shot);
+    }
+  }
+
+  // starts the shooters, releases them together and returns the seconds
+  // until the last one is done
+  template <typename Start>
+  double run(unsigned num_threads, Start start_shooter) {
+    std::atomic<bool> go {false};
+    std::vector<std::thread> shooters;
+    for (unsigned s = 0; s < num_threads; s++) {
+      shooters.push_back(start_shooter(s, std::cref(go)));
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& shooter : shooters) {
+      shooter.join();
+    }
+    return seconds_since(start);
+  }
+
+} // end anonymous namespace
+
+int main() {
+  unsigned cores = std::thread::hardware_concurrency();
+  cores = cores ? cores : 1;
+  unsigned max_threads = cores < 4 ? 4 : cores;
+
+  std::vector<std::vector<Point>> shots(max_threads);
+  for (unsigned s = 0; s < max_threads; s++) {
+    PRNG random(s + 1, 7);
+    shots[s].resize(SHOTS_PER_THREAD);
+    for (Point& shot : shots[s]) {
+      shot = Point {random.Between(0, SIZE - 1), random.Between(0, SIZE - 1)};
+    }
+  }
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << SIZE << "x" << SIZE << ", " << NUM_BOATS << " boats, "
+            << SHOTS_PER_THREAD << " shots per thread, " << cores << " hardware threads\n";
+  std::cout << "threads  concurrent M shots/s  mutex M shots/s\n";
+  for (unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+    ConcurrentOcean concurrent(NUM_BOATS, SIZE, SIZE, num_threads);
+    Ocean *locked = CreateOcean(NUM_BOATS, SIZE, SIZE);
+    PRNG random(3, 5);
+    for (int id = 1; id <= NUM_BOATS; id++) {
+      Boat boat;
+      do {
+        boat = random_boat(random, id);
+      } while (concurrent.PlaceBoat(boat) == bpREJECTED);
+      PlaceBoat(*locked, boat);
+    }
+
+    double concurrent_seconds = run(num_threads, [&](unsigned s, std::reference_wrapper<std::atomic<bool> const> go) {
+      return std::thread(concurrent_shooter, std::ref(concurrent), std::cref(shots[s]), s, go);
+    });
+    std::mutex lock;
+    double locked_seconds = run(num_threads, [&](unsigned s, std::reference_wrapper<std::atomic<bool> const> go) {
+      return std::thread(locked_shooter, std::ref(*locked), std::ref(lock), std::cref(shots[s]), go);
+    });
+
+    ShotStats a = concurrent.GetShotStats();
+    ShotStats b = GetShotStats(*locked);
+    double total = static_cast<double>(num_threads * SHOTS_PER_THREAD);
+    std::cout << std::setw(7) << num_threads << std::setw(22) << total / concurrent_seconds / 1e6
+              << std::setw(17) << total / locked_seconds / 1e6
+              << ((a.hits + a.misses == b.hits + b.misses && a.sunk == b.sunk) ? "" : "   DIFFER")
+              << (num_threads > cores ? "   (more threads than cores)" : "") << "\n";
+    DestroyOcean(locked);
+  }
+}
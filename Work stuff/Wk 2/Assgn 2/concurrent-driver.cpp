@@ -0,0 +1,155 @@
+// Stress test for ConcurrentOcean: every shooter thread fires at every cell
+// of the same ocean, each in its own random order, so each cell is raced
+// for by all of them. The report on stdout checks that each cell gave
+// exactly one HIT/MISS and each boat exactly one SUNK; it depends only on
+// the arguments, not on the thread count, so runs can be diffed. The
+// timing goes to stderr.
+
+#include <atomic>
+#include <chrono>
+#include <functional> // std::cref, std::ref
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrent-ocean.h"
+#include "ocean-internal.h"
+#include "PRNG.h"
+
+namespace {
+  using namespace HLP2::WarBoats;
+
+  void Shooter(ConcurrentOcean& ocean, unsigned shooter, unsigned round, std::atomic<bool> const& go,
+               std::vector<ShotResult>& results) {
+    int cells = ocean.x_size() * ocean.y_size();
+    std::vector<int> order(static_cast<std::size_t>(cells));
+    for (int i = 0; i < cells; i++) {
+      order[static_cast<std::size_t>(i)] = i;
+    }
+    HLP2::Utils::PRNG random(shooter + 1, round + 1);
+    for (int i = cells - 1; i > 0; i--) {
+      std::swap(order[static_cast<std::size_t>(i)], order[static_cast<std::size_t>(random.Between(0, i))]);
+    }
+
+    while (!go.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    for (int cell : order) {
+      Point coordinate {cell % ocean.x_size(), cell / ocean.x_size()};
+      results[static_cast<std::size_t>(cell)] = ocean.TakeShot(coordinate, shooter);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cout << "Usage: ./concurrent.out threads rounds [size boats]\n";
+    return 0;
+  }
+  unsigned num_threads = static_cast<unsigned>(std::stoul(argv[1]));
+  num_threads = num_threads ? num_threads : 1;
+  int rounds = std::stoi(argv[2]);
+  int size = 64;
+  int num_boats = 99;
+  if (argc > 4) {
+    size = std::stoi(argv[3]);
+    num_boats = std::stoi(argv[4]);
+  }
+  if (num_boats < 0 || num_boats > MAX_BOATS) {
+    std::cout << "boats must be 0 to " << MAX_BOATS << "\n";
+    return 0;
+  }
+  int cells = size * size;
+
+  long long hits = 0, misses = 0, sunk = 0, duplicates = 0;
+  long long bad_cells = 0, bad_boats = 0, bad_stats = 0;
+  double seconds = 0;
+  for (int round = 0; round < rounds; round++) {
+      // the fleet depends only on the round, so every thread count plays
+      // the same oceans
+    ConcurrentOcean ocean(num_boats, size, size, num_threads);
+    std::vector<int> owner(static_cast<std::size_t>(cells), 0);
+    HLP2::Utils::PRNG random(static_cast<unsigned>(round) + 1, 0);
+    for (int id = 1; id <= num_boats; id++) {
+      Boat boat {0, id, oHORIZONTAL, Point {0, 0}};
+      do {
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = random.Between(0, size - 1);
+        boat.position.y = random.Between(0, size - 1);
+      } while (ocean.PlaceBoat(boat) == bpREJECTED);
+      for (int i = 0; i < 4; i++) {
+        int x = boat.position.x + (boat.orientation == oHORIZONTAL ? i : 0);
+        int y = boat.position.y + (boat.orientation == oVERTICAL ? i : 0);
+        owner[static_cast<std::size_t>(y * size + x)] = id;
+      }
+    }
+
+    std::vector<std::vector<ShotResult>> results(num_threads,
+                                                 std::vector<ShotResult>(static_cast<std::size_t>(cells), srILLEGAL));
+    std::atomic<bool> go {false};
+    std::vector<std::thread> shooters;
+    for (unsigned s = 1; s < num_threads; s++) {
+      shooters.emplace_back(Shooter, std::ref(ocean), s, static_cast<unsigned>(round), std::cref(go), std::ref(results[s]));
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    Shooter(ocean, 0, static_cast<unsigned>(round), go, results[0]);
+    for (std::thread& shooter : shooters) {
+      shooter.join();
+    }
+    seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      // each cell: one first shot, a hit or sunk exactly where a boat is
+    std::vector<int> sunk_count(static_cast<std::size_t>(num_boats) + 1, 0);
+    ShotStats counted {0, 0, 0, 0};
+    for (int cell = 0; cell < cells; cell++) {
+      int first = 0;
+      for (unsigned s = 0; s < num_threads; s++) {
+        ShotResult result = results[s][static_cast<std::size_t>(cell)];
+        if (result == srDUPLICATE) {
+          counted.duplicates++;
+          continue;
+        }
+        first++;
+        bool on_boat = owner[static_cast<std::size_t>(cell)] != 0;
+        if (result == srMISS) {
+          counted.misses++;
+          bad_cells += on_boat;
+        } else {
+          counted.hits++;
+          bad_cells += !on_boat;
+          if (result == srSUNK) {
+            counted.sunk++;
+            sunk_count[static_cast<std::size_t>(owner[static_cast<std::size_t>(cell)])]++;
+          }
+        }
+      }
+      bad_cells += (first != 1);
+    }
+    for (int id = 1; id <= num_boats; id++) {
+      bad_boats += (sunk_count[static_cast<std::size_t>(id)] != 1);
+    }
+
+    ShotStats merged = ocean.GetShotStats();
+    bad_stats += (merged.hits != counted.hits || merged.misses != counted.misses ||
+                  merged.duplicates != counted.duplicates || merged.sunk != counted.sunk);
+    hits += merged.hits;
+    misses += merged.misses;
+    sunk += merged.sunk;
+    duplicates += merged.duplicates;
+  }
+
+  std::cout << rounds << " rounds, " << num_boats << " boats, " << size << "x" << size << "\n";
+  std::cout << "      Hits: " << hits << "\n";
+  std::cout << "    Misses: " << misses << "\n";
+  std::cout << "Boats Sunk: " << sunk << "\n";
+  std::cout << "Duplicates: " << (duplicates == static_cast<long long>(num_threads - 1) * cells * rounds
+                                  ? "one per extra shooter per cell" : "WRONG") << "\n";
+  std::cout << "Cells not shot exactly once: " << bad_cells << "\n";
+  std::cout << "Boats not sunk exactly once: " << bad_boats << "\n";
+  std::cout << "Rounds with wrong statistics: " << bad_stats << "\n";
+
+  std::cerr << std::fixed << std::setprecision(1) << num_threads << " threads: "
+            << static_cast<double>(num_threads) * cells * rounds / seconds / 1e6 << "M shots/s\n";
+}
@@ -0,0 +1,225 @@
+/*!*************************************************************************
+****
+\file concurrent-ocean.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+An Ocean shared by many shooting threads.
+ The function include:
+- ConcurrentOcean::ConcurrentOcean
+Creates the empty ocean and the counters of every shooter
+- ConcurrentOcean::PlaceBoat
+Places a boat before the shooting starts
+- ConcurrentOcean::TakeShot
+Fires a shot, safe to call from many threads at once
+- ConcurrentOcean::GetShotStats
+Adds up the statistics of the shooters
+****************************************************************************
+***/
+#include "concurrent-ocean.h"
+#include "ocean-internal.h"
+#include <cassert>
+#include <stdexcept> // std::invalid_argument
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Creates an empty ocean for a fixed number of shooters. As with
+CreateOcean, a fleet must keep its IDs below HIT_OFFSET.
+\param num_boats
+The number of boats, 0 to MAX_BOATS; anything else throws
+std::invalid_argument
+\param x_size
+The size of the grid in the x-direction
+\param y_size
+The size of the grid in the y-direction
+\param num_shooters
+Threads that will call TakeShot, each with its own index
+****************************************************************************
+***/
+    ConcurrentOcean::ConcurrentOcean(int num_boats, int x_size, int y_size, unsigned num_shooters)
+      : num_boats(num_boats >= 0 && num_boats <= MAX_BOATS ? num_boats
+                  : throw std::invalid_argument("ConcurrentOcean: num_boats must be 0 to MAX_BOATS")),
+        x(x_size), y(y_size),
+        grid(new std::atomic<int>[static_cast<std::size_t>(x_size) * static_cast<std::size_t>(y_size)]),
+        hits(new std::atomic<int>[static_cast<std::size_t>(num_boats)]),
+        boats(static_cast<std::size_t>(num_boats), Boat {0, 0, oHORIZONTAL, Point {0, 0}}),
+        stats(new ShooterStats[num_shooters]),
+        num_shooters(num_shooters)
+    {
+      for (std::size_t i = 0; i < static_cast<std::size_t>(x_size) * static_cast<std::size_t>(y_size); i++)
+      {
+        grid[i].store(dtOK, std::memory_order_relaxed);
+      }
+      for (int b = 0; b < num_boats; b++)
+      {
+        hits[b].store(0, std::memory_order_relaxed);
+      }
+      for (unsigned s = 0; s < num_shooters; s++)
+      {
+        stats[s].hits.store(0, std::memory_order_relaxed);
+        stats[s].misses.store(0, std::memory_order_relaxed);
+        stats[s].duplicates.store(0, std::memory_order_relaxed);
+        stats[s].sunk.store(0, std::memory_order_relaxed);
+      }
+    }
+
+/*!*************************************************************************
+****
+\brief
+PlaceBoat with the checks of the dynamic Ocean. It is not meant to race
+with other calls; the threads that shoot must be started after the
+boats are placed.
+\param boat
+The boat to place.
+\return
+BoatPlacement enum member
+****************************************************************************
+***/
+    BoatPlacement ConcurrentOcean::PlaceBoat(Boat const& boat)
+    {
+      if (boat.ID < 1 || boat.ID > num_boats || boats[static_cast<std::size_t>(boat.ID - 1)].ID != 0)
+      {
+        return bpREJECTED;
+      }
+      int dx = (boat.orientation == oHORIZONTAL) ? 1 : 0;
+      int dy = 1 - dx;
+      if (boat.position.x < 0 || boat.position.y < 0 ||
+          boat.position.x + dx * (BOAT_LENGTH - 1) >= x ||
+          boat.position.y + dy * (BOAT_LENGTH - 1) >= y)
+      {
+        return bpREJECTED;
+      }
+      std::size_t first = static_cast<std::size_t>(boat.position.y) * static_cast<std::size_t>(x)
+                        + static_cast<std::size_t>(boat.position.x);
+      std::size_t step = static_cast<std::size_t>(dx + dy * x);
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        if (grid[first + static_cast<std::size_t>(i) * step].load(std::memory_order_relaxed) != dtOK)
+        {
+          return bpREJECTED;
+        }
+      }
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        grid[first + static_cast<std::size_t>(i) * step].store(boat.ID, std::memory_order_relaxed);
+      }
+      boats[static_cast<std::size_t>(boat.ID - 1)] = boat;
+      return bpACCEPTED;
+    }
+
+/*!*************************************************************************
+****
+\brief
+Fires a shot; any number of shooters may call it at once. A cell only
+changes by compare-and-swap from open water to dtBLOWNUP or from a boat
+ID to ID + HIT_OFFSET, so however many shots land on a cell together
+exactly one of them is the MISS or HIT and the rest are DUPLICATE. Each
+boat's hits are an atomic counter, and the shot that takes it to
+BOAT_LENGTH is the one reported SUNK.
+\param coordinate
+Where the shot lands.
+\param shooter
+Index of the calling shooter, whose statistics count the shot; must be
+below the num_shooters given to the constructor (asserted)
+\return
+ShotResult enum member
+****************************************************************************
+***/
+    ShotResult ConcurrentOcean::TakeShot(Point const& coordinate, unsigned shooter)
+    {
+      if (coordinate.x < 0 || coordinate.x >= x || coordinate.y < 0 || coordinate.y >= y)
+      {
+        return srILLEGAL;
+      }
+      assert(shooter < num_shooters);
+      ShooterStats& mine = stats[shooter];
+      std::atomic<int>& cell = grid[static_cast<std::size_t>(coordinate.y) * static_cast<std::size_t>(x)
+                                    + static_cast<std::size_t>(coordinate.x)];
+      int value = cell.load(std::memory_order_relaxed);
+      for (;;)
+      {
+        if (value == dtBLOWNUP || value > HIT_OFFSET)
+        {
+          Count(mine.duplicates);
+          return srDUPLICATE;
+        }
+        int shot = (value == dtOK) ? static_cast<int>(dtBLOWNUP) : value + HIT_OFFSET;
+          // on failure value is reloaded, and it can only have become a
+          // shot cell, which the next pass reports as a duplicate
+        if (cell.compare_exchange_weak(value, shot, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+
+      if (value == dtOK)
+      {
+        Count(mine.misses);
+        return srMISS;
+      }
+      Count(mine.hits);
+      if (hits[value - 1].fetch_add(1, std::memory_order_relaxed) + 1 == BOAT_LENGTH)
+      {
+        Count(mine.sunk);
+        return srSUNK;
+      }
+      return srHIT;
+    }
+
+/*!*************************************************************************
+****
+\brief
+Adds up the statistics of every shooter. While shots are in flight it
+gives a recent total, not one instant; once the shooters are joined it is
+exact.
+\return
+ShotStats struct
+****************************************************************************
+***/
+    ShotStats ConcurrentOcean::GetShotStats() const
+    {
+      ShotStats total {0, 0, 0, 0};
+      for (unsigned s = 0; s < num_shooters; s++)
+      {
+        ShotStats part = GetShotStats(s);
+        total.hits += part.hits;
+        total.misses += part.misses;
+        total.duplicates += part.duplicates;
+        total.sunk += part.sunk;
+      }
+      return total;
+    }
+
+/*!*************************************************************************
+****
+\brief
+The statistics of one shooter.
+\param shooter
+Index of the shooter
+\return
+ShotStats struct
+****************************************************************************
+***/
+    ShotStats ConcurrentOcean::GetShotStats(unsigned shooter) const
+    {
+      ShooterStats const& part = stats[shooter];
+      return ShotStats {part.hits.load(std::memory_order_relaxed), part.misses.load(std::memory_order_relaxed),
+                        part.duplicates.load(std::memory_order_relaxed), part.sunk.load(std::memory_order_relaxed)};
+    }
+
+      // a counter written only by its own shooter: no locked add needed
+    void ConcurrentOcean::Count(std::atomic<int>& counter)
+    {
+      counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef CONCURRENT_OCEAN_H
+#define CONCURRENT_OCEAN_H
+////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! An Ocean that many shooters may fire at together. Cells and boat
+      //! hit counters are atomics, and each shooter counts its own
+      //! ShotStats, added up by GetShotStats(). Boats are placed before
+      //! the shooting starts, from one thread.
+    class ConcurrentOcean {
+    public:
+        //! std::invalid_argument unless 0 <= num_boats <= MAX_BOATS
+      ConcurrentOcean(int num_boats, int x_size, int y_size, unsigned num_shooters);
+
+      BoatPlacement PlaceBoat(Boat const& boat);
+      ShotResult TakeShot(Point const& coordinate, unsigned shooter);  //!< shooter < num_shooters
+      ShotStats GetShotStats() const;           //!< may be read while shooting
+      ShotStats GetShotStats(unsigned shooter) const;
+
+      int x_size() const { return x; }
+      int y_size() const { return y; }
+
+    private:
+        // one shooter's counters on a cache line of their own; only that
+        // shooter writes them, so a relaxed load and store is enough
+      struct alignas(64) ShooterStats {
+        std::atomic<int> hits;
+        std::atomic<int> misses;
+        std::atomic<int> duplicates;
+        std::atomic<int> sunk;
+      };
+
+      static void Count(std::atomic<int>& counter);
+
+      int num_boats;
+      int x;
+      int y;
+      std::unique_ptr<std::atomic<int>[]> grid;   //!< values as in olGRID
+      std::unique_ptr<std::atomic<int>[]> hits;   //!< per boat
+      std::vector<Boat> boats;
+      std::unique_ptr<ShooterStats[]> stats;
+      unsigned num_shooters;
+    };
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // CONCURRENT_OCEAN_H
+////////////////////////////////////////////////////////////////////////////////
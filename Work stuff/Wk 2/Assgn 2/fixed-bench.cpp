@@ -0,0 +1,179 @@
+/*!*************************************************************************
+****
+\file fixed-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of the compile-time FixedOcean against the dynamic Ocean.
+ The function include:
+- main()
+Plays the Monte Carlo games of Simulate() (random fleets sunk by random
+shots) on the dynamic Ocean and on FixedOcean from the same PRNG stream,
+checks that both give the same totals and prints the time per game; with
+the argument check it instead compares every placement, shot and cell of
+the two, shot for shot
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include "ocean.h"
+#include "ocean-internal.h"
+#include "fixed-ocean.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  struct Totals {
+    long long shots;
+    long long hits;
+    long long duplicates;
+  };
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  Boat random_boat(PRNG& random, int id, int x_size, int y_size) {
+    Boat boat;
+    boat.ID = id;
+    boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+    boat.position.x = random.Between(0, x_size - 1);
+    boat.position.y = random.Between(0, y_size - 1);
+    return boat;
+  }
+
+  // the game of PlayGame in simulate.cpp on the CreateOcean API
+  void dynamic_game(PRNG& random, int num_boats, int x_size, int y_size, Totals& totals) {
+    Ocean *ocean = CreateOcean(num_boats, x_size, y_size);
+    for (int id = 1; id <= num_boats; id++) {
+      while (PlaceBoat(*ocean, random_boat(random, id, x_size, y_size)) == bpREJECTED) {
+      }
+    }
+    for (int sunk = 0; sunk < num_boats; totals.shots++) {
+      sunk += TakeShot(*ocean, Point {random.Between(0, x_size - 1), random.Between(0, y_size - 1)}) == srSUNK;
+    }
+    totals.hits += GetShotStats(*ocean).hits;
+    totals.duplicates += GetShotStats(*ocean).duplicates;
+    DestroyOcean(ocean);
+  }
+
+  // the same game on a FixedOcean on the stack
+  template <typename OceanType>
+  void fixed_game(PRNG& random, Totals& totals) {
+    OceanType ocean;
+    for (int id = 1; id <= OceanType::num_boats; id++) {
+      while (ocean.PlaceBoat(random_boat(random, id, OceanType::x_size, OceanType::y_size)) == bpREJECTED) {
+      }
+    }
+    for (int sunk = 0; sunk < OceanType::num_boats; totals.shots++) {
+      Point shot {random.Between(0, OceanType::x_size - 1), random.Between(0, OceanType::y_size - 1)};
+      sunk += ocean.TakeShot(shot) == srSUNK;
+    }
+    totals.hits += ocean.GetShotStats().hits;
+    totals.duplicates += ocean.GetShotStats().duplicates;
+  }
+
+  // the same games on both, comparing every PlaceBoat and TakeShot result
+  // and the cells and statistics at the end; shots may fall one cell
+  // outside the ocean
+  template <typename OceanType>
+  bool check(long long games) {
+    PRNG random(5, 6);
+    long long shots = 0;
+    bool same = true;
+    for (long long g = 0; g < games && same; g++) {
+      Ocean *dynamic = CreateOcean(OceanType::num_boats, OceanType::x_size, OceanType::y_size);
+      OceanType fixed;
+      for (int id = 1; id <= OceanType::num_boats && same; id++) {
+        BoatPlacement placed = bpREJECTED;
+        while (same && placed == bpREJECTED) {
+          Boat boat = random_boat(random, id, OceanType::x_size, OceanType::y_size);
+          placed = PlaceBoat(*dynamic, boat);
+          same = fixed.PlaceBoat(boat) == placed;
+        }
+      }
+      for (int sunk = 0; same && sunk < OceanType::num_boats; shots++) {
+        Point shot {random.Between(-1, OceanType::x_size), random.Between(-1, OceanType::y_size)};
+        ShotResult result = TakeShot(*dynamic, shot);
+        same = fixed.TakeShot(shot) == result;
+        sunk += result == srSUNK;
+      }
+      for (int y = 0; y < OceanType::y_size; y++) {
+        for (int x = 0; x < OceanType::x_size; x++) {
+          same = same && fixed.CellValue(x, y) == CellValue(*dynamic, x, y);
+        }
+      }
+      ShotStats a = GetShotStats(*dynamic), b = fixed.GetShotStats();
+      same = same && a.hits == b.hits && a.misses == b.misses && a.duplicates == b.duplicates && a.sunk == b.sunk;
+      DestroyOcean(dynamic);
+    }
+    std::cout << std::setw(4) << OceanType::x_size << "x" << std::left << std::setw(4) << OceanType::y_size
+              << std::right << std::setw(6) << OceanType::num_boats << std::setw(9) << games
+              << std::setw(12) << shots << (same ? "   match" : "   DIFFER") << "\n";
+    return same;
+  }
+
+  template <typename OceanType>
+  void run(long long games) {
+    PRNG dynamic_random(1, 2);
+    Totals dynamic {0, 0, 0};
+    auto start = std::chrono::steady_clock::now();
+    for (long long g = 0; g < games; g++) {
+      dynamic_game(dynamic_random, OceanType::num_boats, OceanType::x_size, OceanType::y_size, dynamic);
+    }
+    double dynamic_time = seconds_since(start);
+
+    PRNG fixed_random(1, 2);
+    Totals fixed {0, 0, 0};
+    start = std::chrono::steady_clock::now();
+    for (long long g = 0; g < games; g++) {
+      fixed_game<OceanType>(fixed_random, fixed);
+    }
+    double fixed_time = seconds_since(start);
+
+    bool same = dynamic.shots == fixed.shots && dynamic.hits == fixed.hits
+             && dynamic.duplicates == fixed.duplicates;
+    std::cout << std::setw(4) << OceanType::x_size << "x" << std::left << std::setw(4) << OceanType::y_size
+              << std::right << std::setw(6) << OceanType::num_boats << std::setw(9) << games
+              << std::setw(12) << static_cast<double>(dynamic.shots) / static_cast<double>(games)
+              << std::setw(12) << dynamic_time * 1e9 / static_cast<double>(games)
+              << std::setw(12) << fixed_time * 1e9 / static_cast<double>(games)
+              << (same ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "check") {
+    std::cout << "    ocean boats    games       shots\n";
+    bool same = check<FixedOcean<10, 10, Fleet<4, 4, 4, 4, 4>>>(2'000);
+    same = check<FixedOcean<8, 12, Fleet<4, 4, 4, 4, 4>>>(2'000) && same;
+    same = check<FixedOcean<4, 30, Fleet<4, 4, 4, 4, 4, 4, 4, 4, 4, 4>>>(2'000) && same;
+    same = check<FixedOcean<1, 4, Fleet<4>>>(2'000) && same;
+    return same ? 0 : 1;
+  }
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "    ocean boats    games  shots/game  dynamic ns    fixed ns\n";
+  run<FixedOcean<10, 10, Fleet<4, 4, 4, 4, 4>>>(200'000);
+  run<FixedOcean<8, 12, Fleet<4, 4, 4, 4, 4>>>(200'000);
+  run<FixedOcean<30, 30, Fleet<4, 4, 4, 4, 4, 4, 4, 4, 4, 4>>>(20'000);
+
+    // a classic fleet of mixed lengths only exists in the fixed variant
+  PRNG random(3, 4);
+  Totals classic {0, 0, 0};
+  auto start = std::chrono::steady_clock::now();
+  for (int g = 0; g < 200'000; g++) {
+    fixed_game<FixedOcean<10, 10, Fleet<5, 4, 3, 3, 2>>>(random, classic);
+  }
+  std::cout << "10x10 fleet 5,4,3,3,2: " << static_cast<double>(classic.shots) / 200'000
+            << " shots/game, " << seconds_since(start) * 1e9 / 200'000 << " ns/game\n";
+}
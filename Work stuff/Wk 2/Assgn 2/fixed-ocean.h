@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FIXED_OCEAN_H
+#define FIXED_OCEAN_H
+////////////////////////////////////////////////////////////////////////////////
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! A fleet known at compile time: the length of boat ID i + 1 is
+      //! the i-th length given, e.g. Fleet<5, 4, 3, 3, 2>
+    template <int... Lengths>
+    struct Fleet {
+      static_assert(sizeof...(Lengths) > 0, "a fleet needs at least one boat");
+      static constexpr int count = sizeof...(Lengths);
+      static constexpr int lengths[count] = {Lengths...};
+      static constexpr int longest() {
+        int most = 0;
+        for (int length : lengths) {
+          most = length > most ? length : most;
+        }
+        return most;
+      }
+      static constexpr int shortest() {
+        int least = lengths[0];
+        for (int length : lengths) {
+          least = length < least ? length : least;
+        }
+        return least;
+      }
+    };
+
+      //! An Ocean whose sizes and fleet are template arguments. It keeps the
+      //! cells and hit counters in arrays inside the object, so it can live
+      //! on the stack, and its loops run over compile-time bounds. Cells
+      //! hold what the olGRID layout stores; boats may differ in length.
+      //! The runtime-sized CreateOcean API is the dynamic variant.
+    template <int X_SIZE, int Y_SIZE, typename FleetType>
+    class FixedOcean {
+      static_assert(X_SIZE > 0 && Y_SIZE > 0, "an ocean needs cells");
+      static_assert(FleetType::count > 0, "a fleet needs at least one boat");
+      static_assert(FleetType::count < 100, "boat IDs must stay below HIT_OFFSET");
+      static_assert(FleetType::shortest() > 0, "every boat needs a cell");
+      static_assert(FleetType::longest() <= (X_SIZE > Y_SIZE ? X_SIZE : Y_SIZE),
+                    "every boat must fit along one side of the ocean");
+
+    public:
+      static constexpr int x_size = X_SIZE;
+      static constexpr int y_size = Y_SIZE;
+      static constexpr int num_boats = FleetType::count;
+
+      FixedOcean() : grid{}, boats{}, stats{0, 0, 0, 0} {}
+
+      BoatPlacement PlaceBoat(Boat const& boat);
+      ShotResult TakeShot(Point const& coordinate);
+      ShotStats GetShotStats() const { return stats; }
+      int CellValue(int x, int y) const { return grid[y * X_SIZE + x]; }
+
+    private:
+      static constexpr int hit_offset = 100;   //!< as HIT_OFFSET in ocean.cpp
+
+      short grid[X_SIZE * Y_SIZE];   //!< values up to 99 + hit_offset
+      Boat boats[FleetType::count];
+      ShotStats stats;
+    };
+
+/*!*************************************************************************
+****
+\brief
+PlaceBoat for a FixedOcean: the checks of the dynamic Ocean, with the
+boat's length taken from the fleet. The loops run to the longest boat of
+the fleet, a constant, so they unroll.
+\param boat
+The boat to place.
+\return
+BoatPlacement enum member
+****************************************************************************
+***/
+    template <int X_SIZE, int Y_SIZE, typename FleetType>
+    BoatPlacement FixedOcean<X_SIZE, Y_SIZE, FleetType>::PlaceBoat(Boat const& boat) {
+      if (boat.ID < 1 || boat.ID > FleetType::count || boats[boat.ID - 1].ID != 0) {
+        return bpREJECTED;
+      }
+      int length = FleetType::lengths[boat.ID - 1];
+      int dx = (boat.orientation == oHORIZONTAL) ? 1 : 0;
+      int dy = 1 - dx;
+      if (boat.position.x < 0 || boat.position.y < 0 ||
+          boat.position.x + dx * (length - 1) >= X_SIZE ||
+          boat.position.y + dy * (length - 1) >= Y_SIZE) {
+        return bpREJECTED;
+      }
+      int first = boat.position.y * X_SIZE + boat.position.x;
+      int step = dx + dy * X_SIZE;
+      for (int i = 0; i < FleetType::longest(); i++) {
+        if (i < length && grid[first + i * step] != 0) {
+          return bpREJECTED;
+        }
+      }
+      for (int i = 0; i < FleetType::longest(); i++) {
+        if (i < length) {
+          grid[first + i * step] = static_cast<short>(boat.ID);
+        }
+      }
+      boats[boat.ID - 1] = boat;
+      boats[boat.ID - 1].hits = 0;
+      return bpACCEPTED;
+    }
+
+/*!*************************************************************************
+****
+\brief
+TakeShot for a FixedOcean, with the results of the dynamic Ocean. A boat
+is sunk when its hits reach its own length from the fleet.
+\param coordinate
+Where the shot lands.
+\return
+ShotResult enum member
+****************************************************************************
+***/
+    template <int X_SIZE, int Y_SIZE, typename FleetType>
+    ShotResult FixedOcean<X_SIZE, Y_SIZE, FleetType>::TakeShot(Point const& coordinate) {
+      if (coordinate.x < 0 || coordinate.x >= X_SIZE || coordinate.y < 0 || coordinate.y >= Y_SIZE) {
+        return srILLEGAL;
+      }
+      short& cell = grid[coordinate.y * X_SIZE + coordinate.x];
+      if (cell == dtOK) {
+        stats.misses++;
+        cell = dtBLOWNUP;
+        return srMISS;
+      }
+      if (cell == dtBLOWNUP || cell > hit_offset) {
+        stats.duplicates++;
+        return srDUPLICATE;
+      }
+
+      stats.hits++;
+      int id = cell;
+      Boat& boat = boats[id - 1];
+      cell = static_cast<short>(id + hit_offset);
+      if (++boat.hits == FleetType::lengths[id - 1]) {
+        stats.sunk++;
+        return srSUNK;
+      }
+      return srHIT;
+    }
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // FIXED_OCEAN_H
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,110 @@
+/*!*************************************************************************
+****
+\file fleet-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of PlaceFleet() against the PlaceBoat retry loop.
+ The function include:
+- main()
+Places fleets that cover 10% to 80% of the cells, both by retrying
+PlaceBoat with random positions (as test_rect does) and with PlaceFleet,
+and prints the time per fleet, the PlaceBoat calls per boat of the retry
+loop, the fleets it gave up on after 10000 calls, and how long PlaceFleet takes to turn down a fleet that cannot fit
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include "ocean.h"
+#include "fleet.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // a fleet that boxed itself in never finishes the retry loop
+  long long const MAX_CALLS {10'000};
+
+  // the loop of test_rect, given up after MAX_CALLS; adds the PlaceBoat
+  // calls it made and returns false if it gave up
+  bool retry_fleet(Ocean& ocean, PRNG& random, long long& calls) {
+    long long limit = calls + MAX_CALLS;
+    for (int id = 1; id <= ocean.num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        if (calls == limit) {
+          return false;
+        }
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = random.Between(0, ocean.x_size - 1);
+        boat.position.y = random.Between(0, ocean.y_size - 1);
+        calls++;
+      } while (PlaceBoat(ocean, boat) == bpREJECTED);
+    }
+    return true;
+  }
+
+  void run(int size, int num_boats, int fleets) {
+    PRNG random(static_cast<unsigned>(size), static_cast<unsigned>(num_boats));
+    long long calls = 0;
+    int stuck = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < fleets; f++) {
+      Ocean *ocean = CreateOcean(num_boats, size, size);
+      stuck += !retry_fleet(*ocean, random, calls);
+      DestroyOcean(ocean);
+    }
+    double retry_time = seconds_since(start);
+
+    int failed = 0;
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < fleets; f++) {
+      Ocean *ocean = CreateOcean(num_boats, size, size);
+      failed += PlaceFleet(*ocean, random) == bpREJECTED;
+      DestroyOcean(ocean);
+    }
+    double fleet_time = seconds_since(start);
+
+    double fill = 100.0 * num_boats * 4 / (static_cast<double>(size) * size);
+    std::cout << std::setw(4) << size << "x" << std::left << std::setw(4) << size << std::right
+              << std::setw(6) << num_boats << std::setw(7) << fill << "%"
+              << std::setw(12) << retry_time * 1e6 / fleets
+              << std::setw(12) << static_cast<double>(calls) / (static_cast<double>(fleets) * num_boats)
+              << std::setw(7) << stuck
+              << std::setw(12) << fleet_time * 1e6 / fleets
+              << std::setw(8) << failed << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "    ocean boats   fill    retry us calls/boat  stuck    fleet us  failed\n";
+  for (int num_boats : {3, 5, 10, 15, 18, 20}) {
+    run(10, num_boats, 2000);
+  }
+  for (int size : {63, 44, 36, 31, 28, 26}) {
+    run(size, 99, 2000);
+  }
+
+  PRNG random(1, 2);
+  Ocean *ocean = CreateOcean(26, 10, 10);
+  auto start = std::chrono::steady_clock::now();
+  BoatPlacement placed = PlaceFleet(*ocean, random);
+  std::cout << "26 boats in 10x10 (at most " << MaxFleet(10, 10) << "): "
+            << (placed == bpREJECTED ? "rejected" : "placed") << " in "
+            << seconds_since(start) * 1e6 << " us\n";
+  DestroyOcean(ocean);
+}
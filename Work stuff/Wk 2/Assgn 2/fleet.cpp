@@ -0,0 +1,320 @@
+/*!*************************************************************************
+****
+\file fleet.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Random fleet placement without rejected PlaceBoat calls.
+ The function include:
+- MaxFleet
+Most boats that fit in an ocean
+- PlaceFleet
+Places a whole fleet, drawing every boat from the placements still free
+****************************************************************************
+***/
+#include "fleet.h"
+#include "ocean-internal.h"
+#include <vector>
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+    // below this share of the cells under boats a random placement is
+    // almost never rejected, and PlaceBoat alone can do the retrying
+    // without a table of the whole ocean
+  double const RETRY_MAX_FILL {0.05};
+    // draws a boat may spend on random positions before the free
+    // placements are listed and drawn from directly; listing costs about
+    // as much as a quarter of the cells in draws
+  int const MIN_RETRIES {8};
+  int const CELLS_PER_RETRY {4};
+    // a draw that runs out of free placements starts over; this only
+    // happens close to the densest packings
+  int const MAX_ATTEMPTS {16};
+  int const NONE {-1};
+
+    // placements are numbered 2 * first cell + orientation
+  Boat MakeBoat(HLP2::WarBoats::Ocean const& ocean, int placement, int id)
+  {
+    int cell = placement / 2;
+    Boat boat;
+    boat.hits = 0;
+    boat.ID = id;
+    boat.orientation = (placement & 1) ? oVERTICAL : oHORIZONTAL;
+    boat.position.x = cell % ocean.x_size;
+    boat.position.y = cell / ocean.x_size;
+    return boat;
+  }
+
+    // the fleet drawn so far, by the cells it covers
+  class Occupancy
+  {
+  public:
+    explicit Occupancy(Ocean const& ocean)
+      : x_size(ocean.x_size), y_size(ocean.y_size),
+        used(static_cast<std::size_t>(ocean.x_size) * static_cast<std::size_t>(ocean.y_size), 0)
+    {
+    }
+
+    bool Fits(int placement) const
+    {
+      int first = placement / 2;
+      int x = first % x_size;
+      int y = first / x_size;
+      int step = (placement & 1) ? x_size : 1;
+      if ((placement & 1) ? (y + BOAT_LENGTH > y_size) : (x + BOAT_LENGTH > x_size))
+      {
+        return false;
+      }
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        if (used[static_cast<std::size_t>(first + i * step)])
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void Occupy(int placement)
+    {
+      int first = placement / 2;
+      int step = (placement & 1) ? x_size : 1;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        used[static_cast<std::size_t>(first + i * step)] = 1;
+      }
+    }
+
+    int x_size;
+    int y_size;
+
+  private:
+    std::vector<unsigned char> used;
+  };
+
+    // the placements that still fit, in any order, with the index of each
+  class FreePlacements
+  {
+  public:
+    explicit FreePlacements(Occupancy const& occupancy)
+      : x_size(occupancy.x_size),
+        where(2 * static_cast<std::size_t>(occupancy.x_size) * static_cast<std::size_t>(occupancy.y_size), NONE)
+    {
+      for (int placement = 0; placement < static_cast<int>(where.size()); placement++)
+      {
+        if (occupancy.Fits(placement))
+        {
+          where[static_cast<std::size_t>(placement)] = static_cast<int>(list.size());
+          list.push_back(placement);
+        }
+      }
+    }
+
+    std::size_t Count() const { return list.size(); }
+    int At(std::size_t i) const { return list[i]; }
+
+      // takes out every placement that overlaps the given one
+    void Occupy(int placement)
+    {
+      int first = placement / 2;
+      int step = (placement & 1) ? x_size : 1;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        int cell = first + i * step;
+        int x = cell % x_size;
+        int y = cell / x_size;
+        for (int k = 0; k < BOAT_LENGTH; k++)
+        {
+          if (x - k >= 0)
+          {
+            Remove(2 * (cell - k));
+          }
+          if (y - k >= 0)
+          {
+            Remove(2 * (cell - k * x_size) + 1);
+          }
+        }
+      }
+    }
+
+  private:
+    void Remove(int placement)
+    {
+      int i = where[static_cast<std::size_t>(placement)];
+      if (i == NONE)
+      {
+        return;
+      }
+      int last = list.back();
+      list[static_cast<std::size_t>(i)] = last;
+      where[static_cast<std::size_t>(last)] = i;
+      list.pop_back();
+      where[static_cast<std::size_t>(placement)] = NONE;
+    }
+
+    int x_size;
+    std::vector<int> where;
+    std::vector<int> list;
+  };
+
+    // Draws the whole fleet; false if it ran out of room. A boat is first
+    // drawn like the PlaceBoat loop, one draw for the orientation and both
+    // coordinates together, and accepted draws of that loop are
+    // uniform over the placements that fit, so once a boat is rejected
+    // max_retries times the rest can be drawn from the list of those
+    // placements without changing the odds.
+  bool DrawFleet(Ocean const& ocean, HLP2::Utils::PRNG& random, std::vector<Boat>& fleet)
+  {
+    Occupancy occupancy(ocean);
+    long long cells = static_cast<long long>(ocean.x_size) * ocean.y_size;
+    long long max_retries = cells / CELLS_PER_RETRY > MIN_RETRIES ? cells / CELLS_PER_RETRY : MIN_RETRIES;
+    fleet.clear();
+    int id = 1;
+    for (; id <= ocean.num_boats; id++)
+    {
+      int placement = NONE;
+      for (long long tries = 0; tries < max_retries && placement == NONE; tries++)
+      {
+        int candidate = static_cast<int>(random.Below(2 * static_cast<unsigned>(cells)));
+        placement = occupancy.Fits(candidate) ? candidate : NONE;
+      }
+      if (placement == NONE)
+      {
+        break;
+      }
+      fleet.push_back(MakeBoat(ocean, placement, id));
+      occupancy.Occupy(placement);
+    }
+    if (id > ocean.num_boats)
+    {
+      return true;
+    }
+
+    FreePlacements free(occupancy);
+    for (; id <= ocean.num_boats; id++)
+    {
+      if (free.Count() == 0)
+      {
+        return false;
+      }
+      int placement = free.At(random.Below(static_cast<unsigned>(free.Count())));
+      fleet.push_back(MakeBoat(ocean, placement, id));
+      free.Occupy(placement);
+    }
+    return true;
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Most boats of BOAT_LENGTH that fit in an ocean without overlapping. With
+both sides at least BOAT_LENGTH, and sides x = a*L + r, y = b*L + s, the
+fewest cells left uncovered are r*s when r + s <= L and (L-r)*(L-s)
+otherwise (Barnes' bound for packing 1xL bricks in a rectangle).
+\param x_size
+Width of the ocean
+\param y_size
+Height of the ocean
+\return
+Number of boats
+****************************************************************************
+***/
+    int MaxFleet(int x_size, int y_size)
+    {
+      if (x_size < BOAT_LENGTH && y_size < BOAT_LENGTH)
+      {
+        return 0;
+      }
+      if (x_size < BOAT_LENGTH)
+      {
+        return x_size * (y_size / BOAT_LENGTH);
+      }
+      if (y_size < BOAT_LENGTH)
+      {
+        return y_size * (x_size / BOAT_LENGTH);
+      }
+      long long r = x_size % BOAT_LENGTH;
+      long long s = y_size % BOAT_LENGTH;
+      long long uncovered = (r + s <= BOAT_LENGTH) ? r * s : (BOAT_LENGTH - r) * (BOAT_LENGTH - s);
+      long long most = (static_cast<long long>(x_size) * y_size - uncovered) / BOAT_LENGTH;
+      return most > 0x7FFFFFFF ? 0x7FFFFFFF : static_cast<int>(most);
+    }
+
+/*!*************************************************************************
+****
+\brief
+Places boats 1..num_boats in an empty ocean. Each boat is uniform over the
+placements that fit and miss the boats before it, the same as retrying
+PlaceBoat with random positions until it is accepted, but every draw
+lands on a free placement:
+ - a fleet that cannot fit (more than MaxFleet) fails before any work
+ - a sparse fleet uses the retry loop, which is almost never rejected
+ - otherwise boats are drawn at random positions against a map of the
+   cells taken, and once a boat misses too many times the placements
+   that fit are listed; each later boat is one draw from the list and
+   takes out at most 2 * BOAT_LENGTH * BOAT_LENGTH placements, so a
+   crowded fleet costs one pass over the ocean plus O(1) a boat
+A draw that runs out of room is started over MAX_ATTEMPTS times and then
+gives up, so near the densest packings a fleet of at most MaxFleet boats
+can still be rejected.
+\param ocean
+Ocean with no boats placed
+\param random
+Generator to draw from
+\return
+bpACCEPTED with every boat placed, or bpREJECTED with none when the fleet
+is larger than MaxFleet or every attempt ran out of room
+****************************************************************************
+***/
+    BoatPlacement PlaceFleet(Ocean& ocean, Utils::PRNG& random)
+    {
+      if (ocean.num_boats > MaxFleet(ocean.x_size, ocean.y_size))
+      {
+        return bpREJECTED;
+      }
+
+      double cells = static_cast<double>(ocean.x_size) * static_cast<double>(ocean.y_size);
+      if (ocean.num_boats * BOAT_LENGTH <= RETRY_MAX_FILL * cells)
+      {
+        for (int id = 1; id <= ocean.num_boats; id++)
+        {
+          Boat boat;
+          boat.ID = id;
+          do
+          {
+            boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+            boat.position.x = random.Between(0, ocean.x_size - 1);
+            boat.position.y = random.Between(0, ocean.y_size - 1);
+          } while (PlaceBoat(ocean, boat) == bpREJECTED);
+        }
+        return bpACCEPTED;
+      }
+
+      std::vector<Boat> fleet;
+      fleet.reserve(static_cast<std::size_t>(ocean.num_boats));
+      for (int attempt = 0; attempt < MAX_ATTEMPTS; attempt++)
+      {
+        if (DrawFleet(ocean, random, fleet))
+        {
+          for (Boat const& boat : fleet)
+          {
+            PlaceBoat(ocean, boat);
+          }
+          return bpACCEPTED;
+        }
+      }
+      return bpREJECTED;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -0,0 +1,25 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef FLEET_H
+#define FLEET_H
+////////////////////////////////////////////////////////////////////////////////
+#include "ocean.h"
+#include "PRNG.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! Most boats that fit in an x_size by y_size ocean without overlapping
+    int MaxFleet(int x_size, int y_size);
+
+      //! Places boats 1..num_boats of an empty ocean at random, each one
+      //! uniform over the placements still free, as a PlaceBoat retry loop
+      //! would; bpREJECTED, with no boat placed, when there are more than
+      //! MaxFleet or when every one of a few draws ran out of room, which
+      //! can happen to a fleet that fits near the densest packings
+    BoatPlacement PlaceFleet(Ocean& ocean, Utils::PRNG& random);
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // FLEET_H
+////////////////////////////////////////////////////////////////////////////////
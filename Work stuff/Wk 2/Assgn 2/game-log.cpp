@@ -0,0 +1,316 @@
+/*!*************************************************************************
+****
+\file game-log.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Binary logs of WarBoats games, and their replay with verification.
+ The function include:
+- GameLog::GameLog
+Starts a log with the fleet of an ocean
+- GameLog::Record
+Adds a shot and its result
+- GameLog::Write
+Appends the game to a log file
+- ReplayGames
+Plays every game of a log again and checks every result
+****************************************************************************
+***/
+#include "game-log.h"
+#include "ocean-internal.h"
+#include <cstring>  // std::memcpy, std::memcmp
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, madvise, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+  char const MAGIC[4] {'W', 'B', 'G', 'L'};
+  unsigned const VERSION {1};
+    // cell + 1 needs 29 bits to leave 3 for the result in 4 bytes
+  long long const NARROW_CELLS {(1LL << 29) - 1};
+    // the layouts index cells with int, so a game of a larger ocean can
+    // only come from a corrupt header
+  long long const MAX_CELLS {0x7FFFFFFF};
+    // shots replayed per TakeShots call
+  std::size_t const REPLAY_BATCH {4096};
+
+  bool SameStats(ShotStats const& a, ShotStats const& b)
+  {
+    return a.hits == b.hits && a.misses == b.misses && a.duplicates == b.duplicates && a.sunk == b.sunk;
+  }
+
+    // a header Write could have written
+  bool ValidHeader(GameLogHeader const& header)
+  {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        header.num_boats < 0 || header.num_boats > MAX_BOATS || header.x_size <= 0 || header.y_size <= 0)
+    {
+      return false;
+    }
+    long long cells = static_cast<long long>(header.x_size) * header.y_size;
+    return cells <= MAX_CELLS && header.shot_bytes == (cells <= NARROW_CELLS ? 4u : 8u);
+  }
+
+    // buffers of a replay, reused by every game
+  struct ReplayBuffers
+  {
+    std::vector<Point> points;
+    std::vector<ShotResult> expected;
+    std::vector<ShotResult> results;
+  };
+
+    // Replays one game that starts at data; returns the shots that did not
+    // give their recorded result, or -1 if the fleet could not be placed
+    // the same way. The shots are decoded a batch at a time and fired
+    // with TakeShots.
+  long long ReplayGame(GameLogHeader const& header, char const *data, OceanLayout layout,
+                       ReplayBuffers& buffers)
+  {
+    Ocean *ocean = CreateOcean(header.num_boats, header.x_size, header.y_size, layout);
+    long long mismatches = 0;
+    for (int b = 0; b < header.num_boats; b++)
+    {
+      GameLogBoat logged;
+      std::memcpy(&logged, data, sizeof(logged));
+      data += sizeof(logged);
+      if (logged.ID == 0)
+      {
+        continue;
+      }
+      Boat boat;
+      boat.hits = 0;
+      boat.ID = logged.ID;
+      boat.orientation = logged.orientation ? oVERTICAL : oHORIZONTAL;
+      boat.position.x = logged.x;
+      boat.position.y = logged.y;
+      if (PlaceBoat(*ocean, boat) == bpREJECTED)
+      {
+        mismatches = -1;
+      }
+    }
+
+    std::vector<Point>& points = buffers.points;
+    std::vector<ShotResult>& expected = buffers.expected;
+    std::vector<ShotResult>& results = buffers.results;
+    unsigned long long x_size = static_cast<unsigned long long>(header.x_size);
+    for (unsigned long long done = 0; mismatches >= 0 && done < header.num_shots; )
+    {
+      std::size_t count = header.num_shots - done < REPLAY_BATCH
+                        ? static_cast<std::size_t>(header.num_shots - done) : REPLAY_BATCH;
+      for (std::size_t i = 0; i < count; i++)
+      {
+        unsigned long long packed;
+        if (header.shot_bytes == 4)
+        {
+          unsigned narrow;
+          std::memcpy(&narrow, data, 4);
+          packed = narrow;
+        }
+        else
+        {
+          std::memcpy(&packed, data, 8);
+        }
+        data += header.shot_bytes;
+        unsigned long long cell = packed >> 3;
+        expected[i] = static_cast<ShotResult>(packed & 7);
+        points[i] = (cell == 0) ? Point {-1, -1}
+                                : Point {static_cast<int>((cell - 1) % x_size), static_cast<int>((cell - 1) / x_size)};
+      }
+      TakeShots(*ocean, points.data(), count, results.data());
+      for (std::size_t i = 0; i < count; i++)
+      {
+        mismatches += results[i] != expected[i];
+      }
+      done += count;
+    }
+    if (mismatches == 0 && !SameStats(GetShotStats(*ocean), header.stats))
+    {
+      mismatches = -1;
+    }
+    DestroyOcean(ocean);
+    return mismatches;
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Starts the log of a game with the fleet of an ocean, as placed so far.
+\param ocean
+Ocean with its boats placed and no shots taken
+****************************************************************************
+***/
+    GameLog::GameLog(Ocean const& ocean)
+      : x_size(ocean.x_size), y_size(ocean.y_size)
+    {
+      for (int b = 0; b < ocean.num_boats; b++)
+      {
+        Boat const& boat = ocean.boats[b];
+        fleet.push_back(GameLogBoat {boat.ID, boat.position.x, boat.position.y,
+                                     boat.orientation == oVERTICAL ? 1 : 0});
+      }
+    }
+
+/*!*************************************************************************
+****
+\brief
+Adds a shot and what TakeShot returned for it. A shot outside the ocean
+is kept as cell 0, so it replays at (-1, -1).
+\param shot
+Cell fired at
+\param result
+Result of the shot
+\return
+void
+****************************************************************************
+***/
+    void GameLog::Record(Point const& shot, ShotResult result)
+    {
+      unsigned long long cell = 0;
+      if (shot.x >= 0 && shot.x < x_size && shot.y >= 0 && shot.y < y_size)
+      {
+        cell = static_cast<unsigned long long>(shot.y) * static_cast<unsigned long long>(x_size)
+             + static_cast<unsigned long long>(shot.x) + 1;
+      }
+      shots.push_back(cell << 3 | static_cast<unsigned long long>(result));
+    }
+
+/*!*************************************************************************
+****
+\brief
+Appends the game to a log: header, fleet, then the shots, 4 bytes each
+unless the ocean is too large for that.
+\param out
+Binary stream of the log
+\param stats
+GetShotStats at the end of the game, checked by the replay
+\return
+void
+****************************************************************************
+***/
+    void GameLog::Write(std::ostream& out, ShotStats const& stats) const
+    {
+      bool narrow = static_cast<long long>(x_size) * y_size <= NARROW_CELLS;
+      GameLogHeader header {{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]}, VERSION, x_size, y_size,
+                            static_cast<int>(fleet.size()), narrow ? 4u : 8u, shots.size(), stats};
+      out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+      out.write(reinterpret_cast<char const*>(fleet.data()),
+                static_cast<std::streamsize>(fleet.size() * sizeof(GameLogBoat)));
+      if (!narrow)
+      {
+        out.write(reinterpret_cast<char const*>(shots.data()),
+                  static_cast<std::streamsize>(shots.size() * sizeof(unsigned long long)));
+        return;
+      }
+      std::vector<unsigned> packed(shots.begin(), shots.end());
+      out.write(reinterpret_cast<char const*>(packed.data()),
+                static_cast<std::streamsize>(packed.size() * sizeof(unsigned)));
+    }
+
+/*!*************************************************************************
+****
+\brief
+Plays every game of a log again in a fresh ocean, places its fleet with
+PlaceBoat, fires its shots with TakeShots and checks every result and the
+final statistics against the log. The file is mapped read-only and read
+front to back, so a corpus larger than memory replays from the page
+cache. A header that Write could not have written (a bad magic, version
+or shot size, a fleet over MAX_BOATS, or more than 2^31 - 1 cells) ends
+the replay as an incomplete log.
+\param filename
+The log
+\param layout
+Layout of the oceans the games are replayed in
+\return
+Counts of games, shots and mismatches
+****************************************************************************
+***/
+    ReplayReport ReplayGames(char const *filename, OceanLayout layout)
+    {
+      ReplayReport report {0, 0, 0, 0, -1, false};
+      int fd = open(filename, O_RDONLY);
+      if (fd < 0)
+      {
+        return report;
+      }
+      struct stat info;
+      if (fstat(fd, &info) != 0)
+      {
+        close(fd);
+        return report;
+      }
+      std::size_t log_size = static_cast<std::size_t>(info.st_size);
+      void *base = nullptr;
+      if (log_size > 0)
+      {
+        base = mmap(nullptr, log_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      }
+      close(fd);
+      if (base == MAP_FAILED)
+      {
+        return report;
+      }
+      if (base != nullptr)
+      {
+        madvise(base, log_size, MADV_SEQUENTIAL);
+      }
+      char const *log = static_cast<char const*>(base);
+
+      ReplayBuffers buffers {std::vector<Point>(REPLAY_BATCH), std::vector<ShotResult>(REPLAY_BATCH),
+                             std::vector<ShotResult>(REPLAY_BATCH)};
+      std::size_t at = 0;
+      bool complete = true;
+      while (at < log_size)
+      {
+        GameLogHeader header;
+        if (log_size - at < sizeof(header))
+        {
+          complete = false;
+          break;
+        }
+        std::memcpy(&header, log + at, sizeof(header));
+        if (!ValidHeader(header))
+        {
+          complete = false;
+          break;
+        }
+        std::size_t size = sizeof(header) + static_cast<std::size_t>(header.num_boats) * sizeof(GameLogBoat);
+        if (log_size - at < size ||
+            (log_size - at - size) / header.shot_bytes < header.num_shots)
+        {
+          complete = false;
+          break;
+        }
+
+        long long mismatches = ReplayGame(header, log + at + sizeof(header), layout, buffers);
+        if (mismatches != 0)
+        {
+          report.mismatched_games++;
+          report.mismatched_shots += mismatches > 0 ? mismatches : 0;
+          report.first_bad_game = report.first_bad_game < 0 ? report.games : report.first_bad_game;
+        }
+        report.games++;
+        report.shots += static_cast<long long>(header.num_shots);
+        at += size + static_cast<std::size_t>(header.num_shots) * header.shot_bytes;
+      }
+      if (base != nullptr)
+      {
+        munmap(base, log_size);
+      }
+      report.complete = complete;
+      return report;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
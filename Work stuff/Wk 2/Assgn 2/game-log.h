@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef GAME_LOG_H
+#define GAME_LOG_H
+////////////////////////////////////////////////////////////////////////////////
+#include <ostream>
+#include <vector>
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! A game log is any number of games back to back, each one a
+      //! GameLogHeader, its fleet as num_boats GameLogBoat, then num_shots
+      //! shots of shot_bytes each: (cell index + 1) << 3 | ShotResult,
+      //! with cell 0 for a shot outside the ocean. Native byte order.
+    struct GameLogHeader {
+      char magic[4];              //!< "WBGL"
+      unsigned version;
+      int x_size;
+      int y_size;
+      int num_boats;
+      unsigned shot_bytes;        //!< 4, or 8 for oceans of 2^29 cells or more
+      unsigned long long num_shots;
+      ShotStats stats;            //!< GetShotStats at the end of the game
+    };
+
+    struct GameLogBoat {
+      int ID;                     //!< 0 for a boat never placed
+      int x;
+      int y;
+      int orientation;
+    };
+
+      //! Records one game: the fleet as placed, then every shot and result
+    class GameLog {
+    public:
+      explicit GameLog(Ocean const& ocean);   //!< after the boats are placed
+
+      void Record(Point const& shot, ShotResult result);
+      void Write(std::ostream& out, ShotStats const& stats) const;  //!< appends the game
+      unsigned long long Shots() const { return shots.size(); }
+
+    private:
+      int x_size;
+      int y_size;
+      std::vector<GameLogBoat> fleet;
+      std::vector<unsigned long long> shots;  //!< packed as in the file
+    };
+
+      //! What a replay found; a game whose fleet or shots do not replay
+      //! the same counts as a mismatch
+    struct ReplayReport {
+      long long games;
+      long long shots;
+      long long mismatched_shots;
+      long long mismatched_games;
+      long long first_bad_game;   //!< -1 when every game replayed the same
+      bool complete;              //!< false if the log is cut short or not a log
+    };
+
+    ReplayReport ReplayGames(char const *filename, OceanLayout layout = olGRID);
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // GAME_LOG_H
+////////////////////////////////////////////////////////////////////////////////
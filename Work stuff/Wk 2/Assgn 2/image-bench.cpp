@@ -0,0 +1,150 @@
+/*!*************************************************************************
+****
+\file image-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of branching a mid-game ocean from a mapped image.
+ The function include:
+- main()
+Plays a large ocean to mid-game and saves it, then starts branches from
+that state three ways: CreateOcean plus replaying every shot, CreateOcean
+plus a copy of the grid, and LoadOcean of the image. Every branch fires
+the same few shots; prints the time per branch and checks that all three
+end with the same statistics
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>   // std::remove
+#include <cstring>  // std::memcpy
+#include <vector>
+#include "ocean.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  char const IMAGE_FILE[] {"image-bench.tmp"};
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  bool same_stats(ShotStats const& a, ShotStats const& b) {
+    return a.hits == b.hits && a.misses == b.misses && a.duplicates == b.duplicates && a.sunk == b.sunk;
+  }
+
+  std::vector<Point> random_shots(PRNG& random, std::size_t count, int size) {
+    std::vector<Point> shots(count);
+    for (Point& shot : shots) {
+      shot = Point {random.Between(0, size - 1), random.Between(0, size - 1)};
+    }
+    return shots;
+  }
+
+  struct Game {
+    int size;
+    int num_boats;
+    std::vector<Boat> fleet;
+    std::vector<Point> history;    // shots played before the branch point
+    std::vector<Point> branch;     // shots each branch fires
+  };
+
+  Ocean* place_fleet(Game const& game) {
+    Ocean *ocean = CreateOcean(game.num_boats, game.size, game.size);
+    for (Boat const& boat : game.fleet) {
+      PlaceBoat(*ocean, boat);
+    }
+    return ocean;
+  }
+
+  ShotStats finish_branch(Ocean *ocean, Game const& game, std::vector<ShotResult>& results) {
+    TakeShots(*ocean, game.branch.data(), game.branch.size(), results.data());
+    ShotStats stats = GetShotStats(*ocean);
+    DestroyOcean(ocean);
+    return stats;
+  }
+
+  void run(int size, std::size_t history_shots, int replay_branches, int branches) {
+    Game game {size, 99, {}, {}, {}};
+    PRNG random(11, 3);
+    Ocean *ocean = CreateOcean(game.num_boats, size, size);
+    for (int id = 1; id <= game.num_boats; id++) {
+      Boat boat {0, id, oHORIZONTAL, Point {0, 0}};
+      do {
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position = Point {random.Between(0, size - 1), random.Between(0, size - 1)};
+      } while (PlaceBoat(*ocean, boat) == bpREJECTED);
+      game.fleet.push_back(boat);
+    }
+    game.history = random_shots(random, history_shots, size);
+    game.branch = random_shots(random, 1000, size);
+    std::vector<ShotResult> results(history_shots);
+    TakeShots(*ocean, game.history.data(), game.history.size(), results.data());
+
+    auto start = std::chrono::steady_clock::now();
+    bool saved = SaveOcean(*ocean, IMAGE_FILE);
+    double save = seconds_since(start);
+
+      // 1: build the ocean again and replay the game up to the branch
+    ShotStats replay_stats {0, 0, 0, 0};
+    start = std::chrono::steady_clock::now();
+    for (int b = 0; b < replay_branches; b++) {
+      Ocean *branch = place_fleet(game);
+      TakeShots(*branch, game.history.data(), game.history.size(), results.data());
+      replay_stats = finish_branch(branch, game, results);
+    }
+    double replay = seconds_since(start) / replay_branches;
+
+      // 2: a new ocean with a full copy of the grid
+    ShotStats copy_stats {0, 0, 0, 0};
+    start = std::chrono::steady_clock::now();
+    for (int b = 0; b < branches; b++) {
+      Ocean *branch = CreateOcean(game.num_boats, size, size);
+      std::memcpy(branch->grid, ocean->grid, static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * sizeof(int));
+      std::memcpy(branch->boats, ocean->boats, static_cast<std::size_t>(game.num_boats) * sizeof(Boat));
+      branch->stats = ocean->stats;
+      copy_stats = finish_branch(branch, game, results);
+    }
+    double copy = seconds_since(start) / branches;
+
+      // 3: map the image copy-on-write
+    ShotStats image_stats {0, 0, 0, 0};
+    start = std::chrono::steady_clock::now();
+    for (int b = 0; b < branches && saved; b++) {
+      Ocean *branch = LoadOcean(IMAGE_FILE);
+      if (branch == nullptr) {
+        saved = false;
+        break;
+      }
+      image_stats = finish_branch(branch, game, results);
+    }
+    double image = seconds_since(start) / branches;
+
+    DestroyOcean(ocean);
+    std::remove(IMAGE_FILE);
+    std::cout << std::setw(5) << size << "x" << std::setw(5) << std::left << size << std::right
+              << std::setw(10) << history_shots << std::setw(10) << save * 1e3
+              << std::setw(12) << replay * 1e6 << std::setw(12) << copy * 1e6 << std::setw(12) << image * 1e6
+              << ((saved && same_stats(replay_stats, copy_stats) && same_stats(replay_stats, image_stats))
+                  ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "1000 shots per branch, times per branch in us\n";
+  std::cout << "      ocean   history   save ms      replay        copy       image\n";
+  run(256, 20'000, 200, 2000);
+  run(1024, 300'000, 20, 500);
+  run(4096, 5'000'000, 3, 200);
+}
@@ -0,0 +1,200 @@
+/*!*************************************************************************
+****
+\file ocean-batch.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+TakeShot for a whole batch of coordinates.
+ The function include:
+- TakeShots
+Fires a batch of shots with the results of one TakeShot call per shot
+****************************************************************************
+***/
+#include "ocean-internal.h"
+#include <algorithm>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+    // Sorting only pays on a grid larger than the cache, and only when the
+    // batch is dense enough that the shots of a row share cache lines; a
+    // sparse batch instead prefetches the cell a few shots ahead.
+  long long const SORT_MIN_CELLS {1 << 20};
+  long long const SORT_CELLS_PER_SHOT {16};
+  std::size_t const PREFETCH_AHEAD {16};
+
+    // one key per shot that lands in the ocean: cell index above, shot
+    // index below, so sorted keys visit the grid row by row and the shots
+    // at one cell keep their order. Both halves are 32 bits, so a longer
+    // batch is fired in pieces and a larger ocean one shot at a time.
+  using ShotKey = unsigned long long;
+  unsigned long long const KEY_LIMIT {1ULL << 32};
+
+  inline ShotKey MakeKey(HLP2::WarBoats::Ocean const& ocean, Point const& p, std::size_t i)
+  {
+    unsigned long long cell = static_cast<unsigned long long>(p.y) * static_cast<unsigned>(ocean.x_size)
+                            + static_cast<unsigned>(p.x);
+    return (cell << 32) | i;
+  }
+
+    // marks the shots outside the ocean srILLEGAL and makes a key for the rest
+  void CheckBounds(Ocean const& ocean, Point const *shots, std::size_t count,
+                   ShotResult *results, std::vector<ShotKey>& keys)
+  {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+      // two points per register; x and y are compared unsigned, by
+      // flipping the sign bit, so negative coordinates fail too
+    __m128i const flip = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    __m128i const limit = _mm_xor_si128(_mm_setr_epi32(ocean.x_size, ocean.y_size, ocean.x_size, ocean.y_size), flip);
+    for (; i + 2 <= count; i += 2)
+    {
+      __m128i p = _mm_loadu_si128(reinterpret_cast<__m128i const*>(shots + i));
+      int inside = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(_mm_xor_si128(p, flip), limit)));
+      if ((inside & 0x3) == 0x3)
+      {
+        keys.push_back(MakeKey(ocean, shots[i], i));
+      }
+      else
+      {
+        results[i] = srILLEGAL;
+      }
+      if ((inside & 0xC) == 0xC)
+      {
+        keys.push_back(MakeKey(ocean, shots[i + 1], i + 1));
+      }
+      else
+      {
+        results[i + 1] = srILLEGAL;
+      }
+    }
+#endif
+    for (; i < count; i++)
+    {
+      Point const& p = shots[i];
+      if (static_cast<unsigned>(p.x) < static_cast<unsigned>(ocean.x_size) &&
+          static_cast<unsigned>(p.y) < static_cast<unsigned>(ocean.y_size))
+      {
+        keys.push_back(MakeKey(ocean, p, i));
+      }
+      else
+      {
+        results[i] = srILLEGAL;
+      }
+    }
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Fires a batch of shots. Every result, and the statistics after the batch,
+are the same as calling TakeShot() once per shot in order.
+On an olGRID ocean the batch is bounds checked two points at a time. On a
+grid too large for the cache a dense batch is sorted by cell so the grid
+is read row by row, and a sparse one prefetches the cells it will read. A boat is only known to be sunk after the pass over
+the grid, so the hits are then walked in shot order and the one that
+completes a boat becomes srSUNK. ShotStats is written once per batch.
+Other layouts, and grids of 2^32 cells or more, take the shots one at a
+time; a batch of 2^32 shots or more is fired in pieces of fewer.
+\param ocean
+The reference to the ocean grid.
+\param shots
+Pointer to the first of count coordinates.
+\param count
+Number of shots.
+\param results
+Pointer to count results, written in shot order.
+\return
+void
+****************************************************************************
+***/
+    void TakeShots(Ocean& ocean, Point const *shots, std::size_t count, ShotResult *results)
+    {
+      long long cells = static_cast<long long>(ocean.x_size) * ocean.y_size;
+      if (ocean.layout != olGRID || static_cast<unsigned long long>(cells) > KEY_LIMIT)
+      {
+        for (std::size_t i = 0; i < count; i++)
+        {
+          results[i] = TakeShot(ocean, shots[i]);
+        }
+        return;
+      }
+      if (count >= KEY_LIMIT)
+      {
+        for (std::size_t first = 0; first < count; first += KEY_LIMIT - 1)
+        {
+          std::size_t n = std::min<std::size_t>(count - first, KEY_LIMIT - 1);
+          TakeShots(ocean, shots + first, n, results + first);
+        }
+        return;
+      }
+
+      std::vector<ShotKey> keys;
+      keys.reserve(count);
+      CheckBounds(ocean, shots, count, results, keys);
+      if (cells >= SORT_MIN_CELLS &&
+          static_cast<long long>(keys.size()) * SORT_CELLS_PER_SHOT >= cells)
+      {
+        std::sort(keys.begin(), keys.end());
+      }
+
+      ShotStats stats = ocean.stats;
+      for (std::size_t k = 0; k < keys.size(); k++)
+      {
+        if (k + PREFETCH_AHEAD < keys.size())
+        {
+          __builtin_prefetch(ocean.grid + (keys[k + PREFETCH_AHEAD] >> 32), 1);
+        }
+        std::size_t i = static_cast<std::size_t>(keys[k] & 0xFFFFFFFFu);
+        int& cell = ocean.grid[keys[k] >> 32];
+        if (cell == dtOK)
+        {
+          stats.misses++;
+          cell = dtBLOWNUP;
+          results[i] = srMISS;
+        }
+        else if (cell == dtBLOWNUP || cell > HIT_OFFSET)
+        {
+          stats.duplicates++;
+          results[i] = srDUPLICATE;
+        }
+        else
+        {
+          stats.hits++;
+          cell += HIT_OFFSET;
+          results[i] = srHIT;
+        }
+      }
+
+        // the boat of a hit is read back from its cell, now ID + HIT_OFFSET
+      for (std::size_t i = 0; i < count; i++)
+      {
+        if (results[i] == srHIT)
+        {
+          long long cell = static_cast<long long>(shots[i].y) * ocean.x_size + shots[i].x;
+          Boat& boat = ocean.boats[ocean.grid[cell] - HIT_OFFSET - 1];
+          if (++boat.hits == BOAT_LENGTH)
+          {
+            stats.sunk++;
+            results[i] = srSUNK;
+          }
+        }
+      }
+      ocean.stats = stats;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -0,0 +1,100 @@
+/*!*************************************************************************
+****
+\file ocean-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of the Ocean layouts.
+ The function include:
+- main()
+Places the same fleet in an olGRID and an olBITBOARD ocean of several
+sizes, fires the same random shots at both, checks that every result and
+the final statistics agree and prints the time per shot and the bytes
+used by the cells of each layout
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include "ocean.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+
+  unsigned next_rand(unsigned long long& state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<unsigned>(state >> 33);
+  }
+
+  void place_fleet(Ocean& ocean, unsigned long long seed) {
+    for (int id = 1; id <= ocean.num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = (next_rand(seed) & 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.x_size));
+        boat.position.y = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.y_size));
+      } while (PlaceBoat(ocean, boat) == bpREJECTED);
+    }
+  }
+
+  double fire(Ocean& ocean, std::vector<Point> const& shots, std::vector<ShotResult>& results) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < shots.size(); i++) {
+      results[i] = TakeShot(ocean, shots[i]);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void run(int size, std::size_t num_shots) {
+    int num_boats = size * size / 40 < 99 ? size * size / 40 : 99;
+    std::vector<Point> shots(num_shots);
+    unsigned long long seed = 99;
+    for (Point& p : shots) {
+      p.x = static_cast<int>(next_rand(seed) % static_cast<unsigned>(size));
+      p.y = static_cast<int>(next_rand(seed) % static_cast<unsigned>(size));
+    }
+
+    Ocean *grid = CreateOcean(num_boats, size, size, olGRID);
+    Ocean *bits = CreateOcean(num_boats, size, size, olBITBOARD);
+    place_fleet(*grid, 7);
+    place_fleet(*bits, 7);
+
+    std::vector<ShotResult> grid_results(num_shots), bits_results(num_shots);
+    double grid_time = fire(*grid, shots, grid_results);
+    double bits_time = fire(*bits, shots, bits_results);
+
+    ShotStats a = GetShotStats(*grid);
+    ShotStats b = GetShotStats(*bits);
+    bool same = grid_results == bits_results && a.hits == b.hits && a.misses == b.misses
+             && a.duplicates == b.duplicates && a.sunk == b.sunk;
+    long long cells = static_cast<long long>(size) * size;
+    long long bit_bytes = 2 * 8 * ((cells + 63) / 64);
+
+    std::cout << std::setw(5) << size << "x" << std::left << std::setw(5) << size << std::right
+              << std::setw(10) << num_shots
+              << std::setw(11) << grid_time * 1e9 / static_cast<double>(num_shots)
+              << std::setw(11) << bits_time * 1e9 / static_cast<double>(num_shots)
+              << std::setw(13) << cells * static_cast<long long>(sizeof(int))
+              << std::setw(13) << bit_bytes
+              << (same ? "   match" : "   DIFFER") << "\n";
+    DestroyOcean(grid);
+    DestroyOcean(bits);
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "      ocean     shots   grid ns   bits ns   grid bytes   bits bytes\n";
+  run(10, 1'000'000);
+  run(100, 4'000'000);
+  run(1'000, 4'000'000);
+  run(10'000, 4'000'000);
+}
@@ -0,0 +1,307 @@
+/*!*************************************************************************
+****
+\file ocean-bitboard.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+The olBITBOARD layout of an Ocean. Instead of one int per cell it keeps
+two bit planes, one bit per cell each: the cells under a boat and the
+cells already fired at; the hit bitboard is their AND, read a word at a
+time, so it is not stored. A duplicate is any cell already in the shot
+plane and a miss a shot cell outside the occupied plane, so those shots
+are two bit tests and one bit set. Each boat also keeps a mask of its
+cells as (plane word, bits) pairs, and a small table indexed by cell
+gives the boat under an occupied cell, so a hit finds its boat in O(1)
+and counts the boat's shot bits with popcounts to tell if it sank. The
+planes cost 2 bits per cell, 16 times less than the olGRID layout; the
+masks and the table grow with the fleet, not the ocean.
+ The function include:
+- CreateBitboard
+Allocates the zeroed bit planes and the boat masks
+- DestroyBitboard
+Frees the bit planes and the boat masks
+- PlaceBoatBitboard
+PlaceBoat for the bit planes
+- TakeShotBitboard
+TakeShot for the bit planes
+- CellValueBitboard
+The value the olGRID layout would store in a cell, for DumpOcean
+****************************************************************************
+***/
+#include "ocean-internal.h"
+#include <vector>
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+      // part k of boat b is the plane word words[b * BOAT_LENGTH + k] and
+      // the boat's bits in it; a horizontal boat shares words between its
+      // cells, leaving the spare parts with no bits. The boat under an
+      // occupied cell is found by linear probing over a power of two
+      // number of slots, sized once for the whole fleet so it is at most
+      // half full; a key is the cell index plus one so 0 marks a free slot
+    struct BoatMasks
+    {
+      std::vector<long long> words;
+      std::vector<unsigned long long> bits;
+      std::vector<long long> keys;
+      std::vector<int> boats;  //!< index in ocean.boats of each key
+      int shift;               //!< 64 - log2(slots), for the multiplicative hash
+    };
+  } // namespace WarBoats
+} // namespace HLP2
+
+namespace
+{
+  using Bits = unsigned long long;
+  using HLP2::WarBoats::BoatMasks;
+
+  inline bool TestBit(Bits const *bits, long long i)
+  {
+    return (bits[i >> 6] >> (i & 63)) & 1;
+  }
+
+  inline void SetBit(Bits *bits, long long i)
+  {
+    bits[i >> 6] |= Bits {1} << (i & 63);
+  }
+
+  inline long long CellIndex(HLP2::WarBoats::Ocean const& ocean, int x, int y)
+  {
+    return static_cast<long long>(y) * ocean.x_size + x;
+  }
+
+  long long WordCount(HLP2::WarBoats::Ocean const& ocean)
+  {
+    return (static_cast<long long>(ocean.x_size) * ocean.y_size + 63) / 64;
+  }
+
+    // slot of key, or the free slot where it would go
+  std::size_t Find(BoatMasks const& masks, long long key)
+  {
+    std::size_t mask = masks.keys.size() - 1;
+    std::size_t slot = static_cast<std::size_t>((static_cast<Bits>(key) * 0x9E3779B97F4A7C15ULL) >> masks.shift);
+    while (masks.keys[slot] != 0 && masks.keys[slot] != key)
+    {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+    // index in ocean.boats of the boat that covers occupied cell i
+  inline int BoatAt(BoatMasks const& masks, long long i)
+  {
+    return masks.boats[Find(masks, i + 1)];
+  }
+
+    // cells of boat b already fired at, one popcount per plane word; the
+    // mask bits are all in the occupied plane, so these are its hits
+  inline int HitsOn(HLP2::WarBoats::Ocean const& ocean, int b)
+  {
+    BoatMasks const& masks = *ocean.masks;
+    int hits = 0;
+    for (int k = b * HLP2::WarBoats::BOAT_LENGTH; k < (b + 1) * HLP2::WarBoats::BOAT_LENGTH; k++)
+    {
+      hits += __builtin_popcountll(ocean.shot[masks.words[k]] & masks.bits[k]);
+    }
+    return hits;
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Allocates the two zeroed bit planes of an olBITBOARD ocean, and the boat
+masks and cell table for its whole fleet.
+\param ocean
+Ocean with its sizes and fleet size set
+\return
+void
+****************************************************************************
+***/
+    void CreateBitboard(Ocean& ocean)
+    {
+      long long words = WordCount(ocean);
+      ocean.occupied = new Bits[words]();
+      ocean.shot = new Bits[words]();
+
+      std::size_t parts = static_cast<std::size_t>(ocean.num_boats) * BOAT_LENGTH;
+      long long slots = 8;
+      while (slots < 2 * static_cast<long long>(parts))
+      {
+        slots *= 2;
+      }
+      ocean.masks = new BoatMasks;
+      ocean.masks->words.assign(parts, 0);
+      ocean.masks->bits.assign(parts, 0);
+      ocean.masks->keys.assign(static_cast<std::size_t>(slots), 0);
+      ocean.masks->boats.assign(static_cast<std::size_t>(slots), -1);
+      ocean.masks->shift = 64;
+      for (long long s = slots; s > 1; s >>= 1)
+      {
+        ocean.masks->shift--;
+      }
+    }
+
+/*!*************************************************************************
+****
+\brief
+Frees the bit planes and the boat masks of an olBITBOARD ocean.
+\param ocean
+The ocean being destroyed
+\return
+void
+****************************************************************************
+***/
+    void DestroyBitboard(Ocean& ocean)
+    {
+      delete [] ocean.occupied;
+      delete [] ocean.shot;
+      delete ocean.masks;
+      ocean.occupied = nullptr;
+      ocean.shot = nullptr;
+      ocean.masks = nullptr;
+    }
+
+/*!*************************************************************************
+****
+\brief
+PlaceBoat for the bit planes: the same checks as the olGRID layout, with
+the overlap test done on the occupied plane. An accepted boat records its
+mask and its cells in the cell table.
+\param ocean
+The reference to the ocean.
+\param boat
+The boat to place.
+\return
+BoatPlacement enum member
+****************************************************************************
+***/
+    BoatPlacement PlaceBoatBitboard(Ocean& ocean, Boat const& boat)
+    {
+      if (boat.ID < 1 || boat.ID > ocean.num_boats || ocean.boats[boat.ID - 1].ID != 0)
+      {
+        return bpREJECTED;
+      }
+      int dx = (boat.orientation == oHORIZONTAL) ? 1 : 0;
+      int dy = 1 - dx;
+      if (boat.position.x < 0 || boat.position.y < 0 ||
+          boat.position.x + dx * (BOAT_LENGTH - 1) >= ocean.x_size ||
+          boat.position.y + dy * (BOAT_LENGTH - 1) >= ocean.y_size)
+      {
+        return bpREJECTED;
+      }
+      long long first = CellIndex(ocean, boat.position.x, boat.position.y);
+      long long step = dx + static_cast<long long>(dy) * ocean.x_size;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        if (TestBit(ocean.occupied, first + i * step))
+        {
+          return bpREJECTED;
+        }
+      }
+
+      BoatMasks& masks = *ocean.masks;
+      int b = boat.ID - 1;
+      int part = b * BOAT_LENGTH;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        long long cell = first + i * step;
+        SetBit(ocean.occupied, cell);
+        if (masks.bits[part] != 0 && masks.words[part] != (cell >> 6))
+        {
+          part++;
+        }
+        masks.words[part] = cell >> 6;
+        masks.bits[part] |= Bits {1} << (cell & 63);
+        std::size_t slot = Find(masks, cell + 1);
+        masks.keys[slot] = cell + 1;
+        masks.boats[slot] = b;
+      }
+      ocean.boats[b] = boat;
+      ocean.boats[b].hits = 0;
+      return bpACCEPTED;
+    }
+
+/*!*************************************************************************
+****
+\brief
+TakeShot for the bit planes. Misses and duplicates never look at the
+fleet; a hit looks its boat up in the cell table and counts the boat's
+shot bits to tell if it sank.
+\param ocean
+The reference to the ocean.
+\param coordinate
+Where the shot lands.
+\return
+ShotResult enum member
+****************************************************************************
+***/
+    ShotResult TakeShotBitboard(Ocean& ocean, Point const& coordinate)
+    {
+      if (coordinate.x < 0 || coordinate.x >= ocean.x_size || coordinate.y < 0 || coordinate.y >= ocean.y_size)
+      {
+        return srILLEGAL;
+      }
+      long long i = CellIndex(ocean, coordinate.x, coordinate.y);
+      if (TestBit(ocean.shot, i))
+      {
+        ocean.stats.duplicates++;
+        return srDUPLICATE;
+      }
+      SetBit(ocean.shot, i);
+      if (!TestBit(ocean.occupied, i))
+      {
+        ocean.stats.misses++;
+        return srMISS;
+      }
+
+      ocean.stats.hits++;
+      int b = BoatAt(*ocean.masks, i);
+      Boat& boat = ocean.boats[b];
+      boat.hits = HitsOn(ocean, b);
+      if (boat.hits == BOAT_LENGTH)
+      {
+        ocean.stats.sunk++;
+        return srSUNK;
+      }
+      return srHIT;
+    }
+
+/*!*************************************************************************
+****
+\brief
+The value the olGRID layout would hold for a cell: 0 for open water,
+dtBLOWNUP for a miss, the boat ID, or the ID plus HIT_OFFSET once hit.
+\param ocean
+The ocean to read.
+\param x
+Column of the cell.
+\param y
+Row of the cell.
+\return
+Cell value
+****************************************************************************
+***/
+    int CellValueBitboard(Ocean const& ocean, int x, int y)
+    {
+      long long i = CellIndex(ocean, x, y);
+      bool shot = TestBit(ocean.shot, i);
+      if (!TestBit(ocean.occupied, i))
+      {
+        return shot ? dtBLOWNUP : dtOK;
+      }
+      int id = ocean.boats[BoatAt(*ocean.masks, i)].ID;
+      return shot ? id + HIT_OFFSET : id;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -13,15 +13,24 @@ void test2();
 void test3();
 void test_rect(int num_boats, int xsize, int ysize, 
               bool show_sunk = true, bool show_all = false);
+
+// layout of every ocean the tests create; the output must not depend on it
+HLP2::WarBoats::OceanLayout layout {HLP2::WarBoats::olGRID};
               
 } // end anonymous namespace
 
 // definitions
 int main(int argc, char *argv[]) {
   if (argc < 2) {
-    std::cout << "Usage: ./ocean.out test-number-between-1-and-6\n";
+    std::cout << "Usage: ./ocean.out test-number-between-1-and-6 [grid|bitboard|sparse]\n";
     return 0;
   }
+  if (argc > 2 && std::string(argv[2]) == "bitboard") {
+    layout = HLP2::WarBoats::olBITBOARD;
+  }
+  if (argc > 2 && std::string(argv[2]) == "sparse") {
+    layout = HLP2::WarBoats::olSPARSE;
+  }
 
   int choice = std::stoi(argv[1]);
   choice = (choice < 1) ? 1 : (choice > 6) ? 6 : choice;
@@ -66,7 +75,7 @@ void test1() {
 
     // Setup the ocean
   int num_boats {3}, xsize {8}, ysize {8};
-  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize);
+  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize, layout);
   HLP2::WarBoats::Ocean &ocean = *theOcean;
 
   std::cout << "The empty board" << "\n";
@@ -136,7 +145,7 @@ void test2() {
 
     // Setup the ocean
   int num_boats{3}, xsize{8}, ysize{8};
-  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize);
+  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize, layout);
   HLP2::WarBoats::Ocean &ocean = *theOcean;
 
   std::cout << "The empty board" << "\n";
@@ -183,7 +192,7 @@ void test3() {
 
     // Setup the ocean (check 100, 30x30)
   int num_boats{5}, xsize{10}, ysize{10};
-  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize);
+  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize, layout);
   HLP2::WarBoats::Ocean &ocean = *theOcean;
 
   std::cout << "The empty board" << "\n";
@@ -256,7 +265,7 @@ void test_rect(int num_boats, int xsize, int ysize, bool show_sunk, bool show_al
     // Initialize the pseudo-random number generator
   HLP2::Utils::srand(0, 0);
 
-  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize);
+  HLP2::WarBoats::Ocean *theOcean = HLP2::WarBoats::CreateOcean(num_boats, xsize, ysize, layout);
   HLP2::WarBoats::Ocean &ocean = *theOcean;
 
     // Place the boats randomly in the ocean
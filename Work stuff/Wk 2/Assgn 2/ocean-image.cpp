@@ -0,0 +1,322 @@
+/*!*************************************************************************
+****
+\file ocean-image.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Flat binary images of an Ocean, to checkpoint a game and branch from it.
+ The function include:
+- SaveOcean
+Writes the grid, boats and statistics of an ocean to an image file
+- LoadOcean
+Maps an image copy-on-write as an olGRID ocean
+- DestroyImage
+Unmaps the image of an ocean made by LoadOcean
+****************************************************************************
+***/
+#include "ocean.h"
+#include "ocean-internal.h"
+#include <cstdio>   // std::rename, std::remove
+#include <cstdlib>  // mkstemp
+#include <cstring>  // std::memcmp, std::memcpy
+#include <string>
+#include <vector>
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat, fchmod
+#include <unistd.h>    // close, pread, sysconf, write
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+      // the mapping behind an ocean from LoadOcean
+    struct OceanImage
+    {
+      void *base;
+      std::size_t bytes;
+    };
+  }
+}
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+    // An image is this header, the boats right after it, then the grid as
+    // one int per cell (the olGRID values) from the next page boundary on,
+    // so a branch that writes a few cells copies only their pages. The
+    // page size is the saving machine's, so any int-aligned grid_offset
+    // past the boats loads. Native byte order.
+  struct ImageHeader
+  {
+    char magic[4];                  //!< "WBOI"
+    unsigned version;
+    int num_boats;
+    int x_size;
+    int y_size;
+    ShotStats stats;
+    unsigned long long boats_offset;
+    unsigned long long grid_offset;
+    unsigned long long bytes;       //!< size of the whole image
+  };
+
+  char const MAGIC[4] {'W', 'B', 'O', 'I'};
+  unsigned const VERSION {1};
+    // the layouts index cells with int
+  long long const MAX_CELLS {0x7FFFFFFF};
+    // cells read per pread when an image is checked
+  std::size_t const CHECK_CELLS {1 << 16};
+
+  unsigned long long PageSize()
+  {
+    static long const page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? static_cast<unsigned long long>(page) : 4096;
+  }
+
+  unsigned long long AlignUp(unsigned long long bytes, unsigned long long align)
+  {
+    return (bytes + align - 1) / align * align;
+  }
+
+    // offsets and size of the image of an ocean with these dimensions
+  ImageHeader MakeHeader(int num_boats, int x_size, int y_size, ShotStats const& stats)
+  {
+    ImageHeader header {{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]}, VERSION, num_boats, x_size, y_size, stats, 0, 0, 0};
+    header.boats_offset = AlignUp(sizeof(ImageHeader), alignof(Boat));
+    header.grid_offset = AlignUp(header.boats_offset + static_cast<unsigned long long>(num_boats) * sizeof(Boat),
+                                 PageSize());
+    header.bytes = header.grid_offset
+                 + static_cast<unsigned long long>(x_size) * static_cast<unsigned long long>(y_size) * sizeof(int);
+    return header;
+  }
+
+    // the sizes, offsets and fleet of a header could come from SaveOcean
+    // of a file of this size
+  bool ValidHeader(ImageHeader const& header, std::size_t file_size)
+  {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        header.num_boats < 0 || header.num_boats > MAX_BOATS || header.x_size <= 0 || header.y_size <= 0 ||
+        static_cast<long long>(header.x_size) * header.y_size > MAX_CELLS)
+    {
+      return false;
+    }
+    ImageHeader expected = MakeHeader(header.num_boats, header.x_size, header.y_size, header.stats);
+    unsigned long long boats_end = expected.boats_offset
+                                 + static_cast<unsigned long long>(header.num_boats) * sizeof(Boat);
+    unsigned long long grid_bytes = expected.bytes - expected.grid_offset;
+    return header.boats_offset == expected.boats_offset && header.grid_offset >= boats_end &&
+           header.grid_offset % alignof(int) == 0 && header.bytes == file_size &&
+           header.bytes >= header.grid_offset && header.bytes - header.grid_offset == grid_bytes;
+  }
+
+    // every boat has taken at most BOAT_LENGTH hits and every cell holds
+    // open water, a miss, or the ID of one of the boats, hit or not. The
+    // cells are read with pread, not through the mapping, which would
+    // fault in every page of the grid; the test has no branch, so the
+    // loop vectorizes.
+  bool ValidCells(int fd, unsigned long long grid_offset, long long cells, Boat const *boats, int num_boats)
+  {
+    for (int b = 0; b < num_boats; b++)
+    {
+      if (boats[b].hits < 0 || boats[b].hits > BOAT_LENGTH)
+      {
+        return false;
+      }
+    }
+      // dtBLOWNUP to num_boats, or HIT_OFFSET + 1 to HIT_OFFSET + num_boats
+    unsigned open_or_boat = static_cast<unsigned>(num_boats) + 1;
+    unsigned hit = static_cast<unsigned>(num_boats);
+    unsigned bad = 0;
+    std::vector<int> chunk(CHECK_CELLS);
+    for (long long done = 0; done < cells && bad == 0; )
+    {
+      std::size_t count = cells - done < static_cast<long long>(CHECK_CELLS)
+                        ? static_cast<std::size_t>(cells - done) : CHECK_CELLS;
+      std::size_t bytes = count * sizeof(int);
+      if (pread(fd, chunk.data(), bytes, static_cast<off_t>(grid_offset + static_cast<unsigned long long>(done) * sizeof(int)))
+          != static_cast<ssize_t>(bytes))
+      {
+        return false;
+      }
+      for (std::size_t i = 0; i < count; i++)
+      {
+        unsigned value = static_cast<unsigned>(chunk[i]);
+        bad |= static_cast<unsigned>(value - static_cast<unsigned>(dtBLOWNUP) > open_or_boat)
+             & static_cast<unsigned>(value - static_cast<unsigned>(HIT_OFFSET) - 1 >= hit);
+      }
+      done += static_cast<long long>(count);
+    }
+    return bad == 0;
+  }
+
+    // write(2) until all of data is out
+  bool WriteAll(int fd, void const *data, std::size_t bytes)
+  {
+    char const *at = static_cast<char const*>(data);
+    while (bytes > 0)
+    {
+      ssize_t wrote = write(fd, at, bytes);
+      if (wrote <= 0)
+      {
+        return false;
+      }
+      at += wrote;
+      bytes -= static_cast<std::size_t>(wrote);
+    }
+    return true;
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Writes an ocean to an image file. Any layout can be saved; its cells are
+written as the olGRID layout stores them. The image is written under a
+temporary name of its own from mkstemp and renamed over filename, so
+oceans already loaded from an older image at that name keep their own
+pages and two savers never write the same file.
+\param ocean
+The ocean to save
+\param filename
+Name of the image file
+\return
+true if the whole image was written
+****************************************************************************
+***/
+    bool SaveOcean(Ocean const& ocean, char const *filename)
+    {
+      ImageHeader header = MakeHeader(ocean.num_boats, ocean.x_size, ocean.y_size, ocean.stats);
+      std::string temporary = std::string(filename) + ".XXXXXX";
+      int fd = mkstemp(&temporary[0]);
+      if (fd < 0)
+      {
+        return false;
+      }
+      fchmod(fd, 0644);   // mkstemp creates it 0600
+
+        // header, boats and the padding between them, in one write
+      std::vector<char> head(header.grid_offset, 0);
+      std::memcpy(head.data(), &header, sizeof(header));
+      std::memcpy(head.data() + header.boats_offset, ocean.boats,
+                  static_cast<std::size_t>(ocean.num_boats) * sizeof(Boat));
+      bool written = WriteAll(fd, head.data(), head.size());
+      if (ocean.layout == olGRID)
+      {
+        written = written && WriteAll(fd, ocean.grid, header.bytes - header.grid_offset);
+      }
+      else
+      {
+        std::vector<int> row(static_cast<std::size_t>(ocean.x_size));
+        for (int y = 0; y < ocean.y_size && written; y++)
+        {
+          for (int x = 0; x < ocean.x_size; x++)
+          {
+            row[static_cast<std::size_t>(x)] = CellValue(ocean, x, y);
+          }
+          written = WriteAll(fd, row.data(), row.size() * sizeof(int));
+        }
+      }
+
+      if (close(fd) != 0 || !written || std::rename(temporary.c_str(), filename) != 0)
+      {
+        std::remove(temporary.c_str());
+        return false;
+      }
+      return true;
+    }
+
+/*!*************************************************************************
+****
+\brief
+Loads an image written by SaveOcean as an olGRID ocean. The file is
+mapped private, so the grid and boats are read from the page cache and a
+page is only copied when this ocean first writes to it: loading one
+mid-game image many times branches the game for the cost of the pages
+each branch changes. The header, the boats' hit counts and every cell are
+checked first, so a corrupt image cannot send TakeShot outside the fleet;
+the grid is checked through the file, so it maps no pages of the grid. The ocean is freed
+with DestroyOcean as usual.
+\param filename
+Name of the image file
+\return
+Ocean pointer, or nullptr if the file cannot be mapped or is not an image
+****************************************************************************
+***/
+    Ocean* LoadOcean(char const *filename)
+    {
+      int fd = open(filename, O_RDONLY);
+      if (fd < 0)
+      {
+        return nullptr;
+      }
+      struct stat info;
+      if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(ImageHeader)))
+      {
+        close(fd);
+        return nullptr;
+      }
+      std::size_t bytes = static_cast<std::size_t>(info.st_size);
+      void *base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (base == MAP_FAILED)
+      {
+        close(fd);
+        return nullptr;
+      }
+
+      ImageHeader const& header = *static_cast<ImageHeader const*>(base);
+      char *data = static_cast<char*>(base);
+      bool valid = ValidHeader(header, bytes) &&
+                   ValidCells(fd, header.grid_offset, static_cast<long long>(header.x_size) * header.y_size,
+                              reinterpret_cast<Boat const*>(data + header.boats_offset), header.num_boats);
+      close(fd);
+      if (!valid)
+      {
+        munmap(base, bytes);
+        return nullptr;
+      }
+
+      Ocean* oceany = new Ocean;
+      oceany->layout = olGRID;
+      oceany->grid = reinterpret_cast<int*>(data + header.grid_offset);
+      oceany->boats = reinterpret_cast<Boat*>(data + header.boats_offset);
+      oceany->occupied = nullptr;
+      oceany->shot = nullptr;
+      oceany->masks = nullptr;
+      oceany->sparse = nullptr;
+      oceany->num_boats = header.num_boats;
+      oceany->x_size = header.x_size;
+      oceany->y_size = header.y_size;
+      oceany->stats = header.stats;
+      oceany->image = new OceanImage {base, bytes};
+      return oceany;
+    }
+
+/*!*************************************************************************
+****
+\brief
+Unmaps the image behind an ocean from LoadOcean; called by DestroyOcean.
+\param ocean
+The ocean whose grid and boats are in a mapped image
+\return
+void
+****************************************************************************
+***/
+    void DestroyImage(Ocean& ocean)
+    {
+      munmap(ocean.image->base, ocean.image->bytes);
+      delete ocean.image;
+      ocean.image = nullptr;
+      ocean.grid = nullptr;
+      ocean.boats = nullptr;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -0,0 +1,40 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef OCEAN_INTERNAL_H
+#define OCEAN_INTERNAL_H
+////////////////////////////////////////////////////////////////////////////////
+// Shared by the Ocean layouts; not part of the interface in ocean.h
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+    int const BOAT_LENGTH {4};   //!< Length of a boat
+    int const HIT_OFFSET  {100}; //!< Add this to the boat ID
+    int const MAX_BOATS   {HIT_OFFSET - 1}; //!< A hit ID must stay above every boat ID
+
+      // the value the olGRID layout would store in a cell, in any layout
+    int CellValue(Ocean const& ocean, int x, int y);
+
+      // olBITBOARD (ocean-bitboard.cpp)
+    void CreateBitboard(Ocean& ocean);
+    void DestroyBitboard(Ocean& ocean);
+    BoatPlacement PlaceBoatBitboard(Ocean& ocean, Boat const& boat);
+    ShotResult TakeShotBitboard(Ocean& ocean, Point const& coordinate);
+    int CellValueBitboard(Ocean const& ocean, int x, int y);
+
+      // olSPARSE (ocean-sparse.cpp)
+    void CreateSparse(Ocean& ocean);
+    void DestroySparse(Ocean& ocean);
+    BoatPlacement PlaceBoatSparse(Ocean& ocean, Boat const& boat);
+    ShotResult TakeShotSparse(Ocean& ocean, Point const& coordinate);
+    int CellValueSparse(Ocean const& ocean, int x, int y);
+    long long SparseBytes(Ocean const& ocean);
+
+      // LoadOcean images (ocean-image.cpp)
+    void DestroyImage(Ocean& ocean);
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // OCEAN_INTERNAL_H
+////////////////////////////////////////////////////////////////////////////////
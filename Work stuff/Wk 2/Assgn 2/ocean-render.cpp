@@ -0,0 +1,257 @@
+/*!*************************************************************************
+****
+\file ocean-render.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Buffered rendering of an Ocean for DumpOcean and for live replays.
+ The function include:
+- OceanRenderer::OceanRenderer
+Sets the formatting of the frames
+- OceanRenderer::Frame
+Formats the whole ocean, or a rectangle of it, into one buffer
+- OceanRenderer::Diff
+Formats only the cells changed since the last frame, as cursor moves
+****************************************************************************
+***/
+#include "ocean-render.h"
+#include "ocean-internal.h"
+#include <charconv> // std::to_chars
+#include <cstring>  // std::memcpy
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+  int const MIN_VALUE {dtBLOWNUP};
+  char const CLEAR_SCREEN[] {"\x1b[H\x1b[2J"};
+  char const HOME[] {"\x1b[H"};
+
+    // ESC [ row ; column H, 1-based, moves the terminal cursor
+  void AppendCursor(std::string& out, int row, int column)
+  {
+    char digits[16];
+    out.append("\x1b[", 2);
+    out.append(digits, static_cast<std::size_t>(std::to_chars(digits, digits + sizeof(digits), row).ptr - digits));
+    out.push_back(';');
+    out.append(digits, static_cast<std::size_t>(std::to_chars(digits, digits + sizeof(digits), column).ptr - digits));
+    out.push_back('H');
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Sets how cells are printed, with the meaning of the DumpOcean arguments.
+The table of cell text is built the first time an ocean is rendered.
+\param field_width
+How much space each position takes when printed.
+\param extraline
+If true, an empty line follows each row.
+\param showboats
+If false, boats that were not hit print as open water.
+****************************************************************************
+***/
+    OceanRenderer::OceanRenderer(int field_width, bool extraline, bool showboats)
+      : field_width(field_width), extraline(extraline), showboats(showboats),
+        stride(0), previous_x(0), previous_y(0)
+    {
+    }
+
+/*!*************************************************************************
+****
+\brief
+Formats the whole ocean as DumpOcean prints it.
+\param ocean
+The Ocean to print.
+\return
+The frame, valid until the next call on this renderer
+****************************************************************************
+***/
+    std::string const& OceanRenderer::Frame(Ocean const& ocean)
+    {
+      return Frame(ocean, Point {0, 0}, ocean.x_size, ocean.y_size);
+    }
+
+/*!*************************************************************************
+****
+\brief
+Formats a rectangle of the ocean, clipped to it, as DumpOceanView prints
+it. The frame is written through a pointer into a buffer sized for the
+widest cell text, copying each cell from the table, with no formatting
+done per cell.
+\param ocean
+The Ocean to print.
+\param origin
+Top-left cell of the rectangle.
+\param columns
+Width of the rectangle in cells.
+\param rows
+Height of the rectangle in cells.
+\return
+The frame, valid until the next call on this renderer
+****************************************************************************
+***/
+    std::string const& OceanRenderer::Frame(Ocean const& ocean, Point const& origin, int columns, int rows)
+    {
+      BuildTable(ocean.num_boats);
+
+      int x_begin = origin.x < 0 ? 0 : origin.x;
+      int y_begin = origin.y < 0 ? 0 : origin.y;
+      int x_end = (columns > ocean.x_size - origin.x) ? ocean.x_size : origin.x + columns;
+      int y_end = (rows > ocean.y_size - origin.y) ? ocean.y_size : origin.y + rows;
+      if (x_end < x_begin || y_end < y_begin)
+      {
+        frame.clear();
+        return frame;
+      }
+
+      std::size_t line = static_cast<std::size_t>(x_end - x_begin) * static_cast<std::size_t>(stride) + 2;
+      std::size_t capacity = static_cast<std::size_t>(y_end - y_begin) * line;
+      if (frame.size() < capacity)
+      {
+        frame.resize(capacity);
+      }
+      char *out = &frame[0];
+      for (int y = y_begin; y < y_end; y++)
+      {
+        if (ocean.layout == olGRID)
+        {
+          int const *row = ocean.grid + y * ocean.x_size;
+          for (int x = x_begin; x < x_end; x++)
+          {
+            AppendCell(out, Shown(row[x]));
+          }
+        }
+        else
+        {
+          for (int x = x_begin; x < x_end; x++)
+          {
+            AppendCell(out, Shown(CellValue(ocean, x, y)));
+          }
+        }
+        *out++ = '\n';
+        if (extraline)
+        {
+          *out++ = '\n';
+        }
+      }
+      frame.resize(static_cast<std::size_t>(out - &frame[0]));
+      return frame;
+    }
+
+/*!*************************************************************************
+****
+\brief
+Formats the changes to the ocean since the last Diff() of it, for a
+terminal showing that frame: each changed cell is a cursor move and its
+text, and the cursor is left below the frame. The first call, a call for
+an ocean of another size, or cell text wider than field_width (which
+moves the columns) gives the whole frame instead.
+\param ocean
+The Ocean to print.
+\return
+The update, valid until the next call on this renderer
+****************************************************************************
+***/
+    std::string const& OceanRenderer::Diff(Ocean const& ocean)
+    {
+        // an ocean of the same size may have more boats than the table
+      BuildTable(ocean.num_boats);
+      bool same_ocean = !previous.empty() && previous_x == ocean.x_size && previous_y == ocean.y_size;
+      if (!same_ocean || stride > field_width)
+      {
+        std::string prefix = same_ocean ? HOME : CLEAR_SCREEN;
+        Frame(ocean);
+        frame.insert(0, prefix);
+        Remember(ocean);
+        return frame;
+      }
+
+      frame.clear();
+      int lines_per_row = extraline ? 2 : 1;
+      for (int y = 0; y < ocean.y_size; y++)
+      {
+        for (int x = 0; x < ocean.x_size; x++)
+        {
+          std::size_t i = static_cast<std::size_t>(y) * static_cast<std::size_t>(ocean.x_size)
+                        + static_cast<std::size_t>(x);
+          int value = Shown(ocean.layout == olGRID ? ocean.grid[i] : CellValue(ocean, x, y));
+          if (value != previous[i])
+          {
+            previous[i] = value;
+            AppendCursor(frame, y * lines_per_row + 1, x * field_width + 1);
+            std::size_t entry = static_cast<std::size_t>(value - MIN_VALUE);
+            frame.append(&text[entry * static_cast<std::size_t>(stride)], length[entry]);
+          }
+        }
+      }
+      if (!frame.empty())
+      {
+        AppendCursor(frame, ocean.y_size * lines_per_row + 1, 1);
+      }
+      return frame;
+    }
+
+      // grows the table to one entry per value from dtBLOWNUP to the last
+      // boat ID hit, right aligned in field_width like std::setw
+    void OceanRenderer::BuildTable(int num_boats)
+    {
+      int max_value = num_boats + HIT_OFFSET;
+      if (static_cast<int>(length.size()) >= max_value - MIN_VALUE + 1)
+      {
+        return;
+      }
+      std::string widest = std::to_string(max_value);
+      stride = field_width > static_cast<int>(widest.size()) ? field_width : static_cast<int>(widest.size());
+      stride = stride > 2 ? stride : 2;
+      length.assign(static_cast<std::size_t>(max_value - MIN_VALUE + 1), 0);
+      text.assign(length.size() * static_cast<std::size_t>(stride), ' ');
+      for (int value = MIN_VALUE; value <= max_value; value++)
+      {
+        std::string digits = std::to_string(value);
+        int size = field_width > static_cast<int>(digits.size()) ? field_width : static_cast<int>(digits.size());
+        char *entry = &text[static_cast<std::size_t>(value - MIN_VALUE) * static_cast<std::size_t>(stride)];
+        std::memcpy(entry + size - digits.size(), digits.data(), digits.size());
+        length[static_cast<std::size_t>(value - MIN_VALUE)] = static_cast<unsigned char>(size);
+      }
+    }
+
+      // the value printed for a cell
+    int OceanRenderer::Shown(int value) const
+    {
+      return ((value > 0) && (value < HIT_OFFSET) && (showboats == false)) ? 0 : value;
+    }
+
+    void OceanRenderer::AppendCell(char *& out, int value) const
+    {
+      std::size_t entry = static_cast<std::size_t>(value - MIN_VALUE);
+      std::memcpy(out, &text[entry * static_cast<std::size_t>(stride)], static_cast<std::size_t>(stride));
+      out += length[entry];
+    }
+
+      // keeps the printed cell values for the next Diff()
+    void OceanRenderer::Remember(Ocean const& ocean)
+    {
+      previous_x = ocean.x_size;
+      previous_y = ocean.y_size;
+      previous.resize(static_cast<std::size_t>(ocean.x_size) * static_cast<std::size_t>(ocean.y_size));
+      for (int y = 0; y < ocean.y_size; y++)
+      {
+        for (int x = 0; x < ocean.x_size; x++)
+        {
+          previous[static_cast<std::size_t>(y) * static_cast<std::size_t>(ocean.x_size) + static_cast<std::size_t>(x)]
+            = Shown(CellValue(ocean, x, y));
+        }
+      }
+    }
+  } // namespace WarBoats
+} // namespace HLP2
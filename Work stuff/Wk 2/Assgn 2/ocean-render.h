@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef OCEAN_RENDER_H
+#define OCEAN_RENDER_H
+////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! Formats DumpOcean frames into one reusable buffer, from a table of
+      //! the padded text of every cell value, so a frame is one write.
+      //! Diff() gives only the cells changed since the last whole frame, as
+      //! ANSI cursor moves, for redrawing a game in a terminal as it plays.
+    class OceanRenderer {
+    public:
+      explicit OceanRenderer(int field_width = 4, bool extraline = false,
+                             bool showboats = true);
+
+        //! Text DumpOcean prints for the whole ocean
+      std::string const& Frame(Ocean const& ocean);
+        //! Text DumpOceanView prints for a rectangle of the ocean
+      std::string const& Frame(Ocean const& ocean, Point const& origin, int columns, int rows);
+        //! ANSI text that turns the last frame of this ocean into the
+        //! current one; the whole frame, after a clear, the first time
+      std::string const& Diff(Ocean const& ocean);
+
+    private:
+      void BuildTable(int num_boats);
+      int Shown(int value) const;
+      void AppendCell(char *& out, int value) const;
+      void Remember(Ocean const& ocean);
+
+      int field_width;
+      bool extraline;
+      bool showboats;
+      int stride;                        //!< bytes per entry of text
+      std::vector<char> text;            //!< padded text of each cell value
+      std::vector<unsigned char> length;
+      std::string frame;                 //!< the buffer handed out
+      std::vector<int> previous;         //!< cell values of the last frame
+      int previous_x;
+      int previous_y;
+    };
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // OCEAN_RENDER_H
+////////////////////////////////////////////////////////////////////////////////
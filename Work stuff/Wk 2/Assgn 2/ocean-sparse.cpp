@@ -0,0 +1,294 @@
+/*!*************************************************************************
+****
+\file ocean-sparse.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+The olSPARSE layout of an Ocean. Only the cells that hold a boat or were
+fired at are stored, in an open addressing hash table keyed by cell
+index, with the value the olGRID layout would store there. Memory grows
+with the boats placed and the shots fired, not with the size of the
+ocean, so a 100000x100000 ocean with a few hundred boats fits in a few
+kilobytes.
+ The function include:
+- CreateSparse
+Allocates an empty cell table
+- DestroySparse
+Frees the cell table
+- PlaceBoatSparse
+PlaceBoat for the cell table
+- TakeShotSparse
+TakeShot for the cell table
+- CellValueSparse
+The value the olGRID layout would store in a cell, for DumpOcean
+- SparseBytes
+Bytes held by the cell table
+****************************************************************************
+***/
+#include "ocean-internal.h"
+#include <vector>
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+      // linear probing over a power of two number of slots, kept at most
+      // half full; a key is the cell index plus one so 0 marks a free slot
+    struct SparseCells
+    {
+      std::vector<long long> keys;
+      std::vector<int> values;
+      long long count;
+      int shift;            //!< 64 - log2(slots), for the multiplicative hash
+    };
+  } // namespace WarBoats
+} // namespace HLP2
+
+namespace
+{
+  using HLP2::WarBoats::SparseCells;
+
+  long long const FIRST_SLOTS {64};
+
+  inline long long CellIndex(HLP2::WarBoats::Ocean const& ocean, int x, int y)
+  {
+    return static_cast<long long>(y) * ocean.x_size + x;
+  }
+
+  inline std::size_t Home(SparseCells const& cells, long long key)
+  {
+    return static_cast<std::size_t>((static_cast<unsigned long long>(key) * 0x9E3779B97F4A7C15ULL) >> cells.shift);
+  }
+
+    // slot of key, or the free slot where it would go
+  std::size_t Find(SparseCells const& cells, long long key)
+  {
+    std::size_t mask = cells.keys.size() - 1;
+    std::size_t slot = Home(cells, key);
+    while (cells.keys[slot] != 0 && cells.keys[slot] != key)
+    {
+      slot = (slot + 1) & mask;
+    }
+    return slot;
+  }
+
+  void Allocate(SparseCells& cells, long long slots)
+  {
+    cells.keys.assign(static_cast<std::size_t>(slots), 0);
+    cells.values.assign(static_cast<std::size_t>(slots), 0);
+    cells.shift = 64;
+    for (long long s = slots; s > 1; s >>= 1)
+    {
+      cells.shift--;
+    }
+  }
+
+  void Grow(SparseCells& cells)
+  {
+    std::vector<long long> keys;
+    std::vector<int> values;
+    keys.swap(cells.keys);
+    values.swap(cells.values);
+    Allocate(cells, 2 * static_cast<long long>(keys.size()));
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+      if (keys[i] != 0)
+      {
+        std::size_t slot = Find(cells, keys[i]);
+        cells.keys[slot] = keys[i];
+        cells.values[slot] = values[i];
+      }
+    }
+  }
+
+    // value stored for a cell, or 0 (dtOK) when it was never touched
+  int Lookup(SparseCells const& cells, long long cell)
+  {
+    std::size_t slot = Find(cells, cell + 1);
+    return cells.keys[slot] != 0 ? cells.values[slot] : 0;
+  }
+
+    // the stored value of a cell, added as 0 (dtOK) when missing
+  int& Touch(SparseCells& cells, long long cell)
+  {
+    if (2 * (cells.count + 1) > static_cast<long long>(cells.keys.size()))
+    {
+      Grow(cells);
+    }
+    std::size_t slot = Find(cells, cell + 1);
+    if (cells.keys[slot] == 0)
+    {
+      cells.keys[slot] = cell + 1;
+      cells.count++;
+    }
+    return cells.values[slot];
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Allocates the empty cell table of an olSPARSE ocean.
+\param ocean
+Ocean with its sizes set
+\return
+void
+****************************************************************************
+***/
+    void CreateSparse(Ocean& ocean)
+    {
+      ocean.sparse = new SparseCells {{}, {}, 0, 64};
+      Allocate(*ocean.sparse, FIRST_SLOTS);
+    }
+
+/*!*************************************************************************
+****
+\brief
+Frees the cell table of an olSPARSE ocean.
+\param ocean
+The ocean being destroyed
+\return
+void
+****************************************************************************
+***/
+    void DestroySparse(Ocean& ocean)
+    {
+      delete ocean.sparse;
+      ocean.sparse = nullptr;
+    }
+
+/*!*************************************************************************
+****
+\brief
+PlaceBoat for the cell table: the same checks as the olGRID layout, with
+the overlap test done by looking the cells up.
+\param ocean
+The reference to the ocean.
+\param boat
+The boat to place.
+\return
+BoatPlacement enum member
+****************************************************************************
+***/
+    BoatPlacement PlaceBoatSparse(Ocean& ocean, Boat const& boat)
+    {
+      if (boat.ID < 1 || boat.ID > ocean.num_boats || ocean.boats[boat.ID - 1].ID != 0)
+      {
+        return bpREJECTED;
+      }
+      int dx = (boat.orientation == oHORIZONTAL) ? 1 : 0;
+      int dy = 1 - dx;
+      if (boat.position.x < 0 || boat.position.y < 0 ||
+          boat.position.x + dx * (BOAT_LENGTH - 1) >= ocean.x_size ||
+          boat.position.y + dy * (BOAT_LENGTH - 1) >= ocean.y_size)
+      {
+        return bpREJECTED;
+      }
+      long long first = CellIndex(ocean, boat.position.x, boat.position.y);
+      long long step = dx + static_cast<long long>(dy) * ocean.x_size;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        if (Lookup(*ocean.sparse, first + i * step) != 0)
+        {
+          return bpREJECTED;
+        }
+      }
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        Touch(*ocean.sparse, first + i * step) = boat.ID;
+      }
+      ocean.boats[boat.ID - 1] = boat;
+      ocean.boats[boat.ID - 1].hits = 0;
+      return bpACCEPTED;
+    }
+
+/*!*************************************************************************
+****
+\brief
+TakeShot for the cell table. A miss adds its cell to the table so a
+second shot there is a duplicate; shots outside the ocean add nothing.
+\param ocean
+The reference to the ocean.
+\param coordinate
+Where the shot lands.
+\return
+ShotResult enum member
+****************************************************************************
+***/
+    ShotResult TakeShotSparse(Ocean& ocean, Point const& coordinate)
+    {
+      if (coordinate.x < 0 || coordinate.x >= ocean.x_size || coordinate.y < 0 || coordinate.y >= ocean.y_size)
+      {
+        return srILLEGAL;
+      }
+      int& cell = Touch(*ocean.sparse, CellIndex(ocean, coordinate.x, coordinate.y));
+      if (cell == dtOK)
+      {
+        ocean.stats.misses++;
+        cell = dtBLOWNUP;
+        return srMISS;
+      }
+      if (cell == dtBLOWNUP || cell > HIT_OFFSET)
+      {
+        ocean.stats.duplicates++;
+        return srDUPLICATE;
+      }
+
+      ocean.stats.hits++;
+      Boat& boat = ocean.boats[cell - 1];
+      boat.hits++;
+      cell += HIT_OFFSET;
+      if (boat.hits == BOAT_LENGTH)
+      {
+        ocean.stats.sunk++;
+        return srSUNK;
+      }
+      return srHIT;
+    }
+
+/*!*************************************************************************
+****
+\brief
+The value the olGRID layout would hold for a cell: 0 for open water,
+dtBLOWNUP for a miss, the boat ID, or the ID plus HIT_OFFSET once hit.
+\param ocean
+The ocean to read.
+\param x
+Column of the cell.
+\param y
+Row of the cell.
+\return
+Cell value
+****************************************************************************
+***/
+    int CellValueSparse(Ocean const& ocean, int x, int y)
+    {
+      return Lookup(*ocean.sparse, CellIndex(ocean, x, y));
+    }
+
+/*!*************************************************************************
+****
+\brief
+Bytes held by the cell table of an olSPARSE ocean, for benchmarks.
+\param ocean
+The ocean to measure.
+\return
+Bytes of the table and its slots
+****************************************************************************
+***/
+    long long SparseBytes(Ocean const& ocean)
+    {
+      SparseCells const& cells = *ocean.sparse;
+      return static_cast<long long>(sizeof(SparseCells)
+           + cells.keys.capacity() * sizeof(long long) + cells.values.capacity() * sizeof(int));
+    }
+  } // namespace WarBoats
+} // namespace HLP2
@@ -25,21 +25,24 @@ to determine the result of the shot.
 This function returns the statistics from the free store object referenced by ocean.
 - DumpOcean
 Prints the grid (ocean) to the screen.
+- DumpOceanView
+Prints a rectangle of the grid (ocean) to the screen.
+- CellValue
+The value the olGRID layout would store in a cell, in any layout
 Takes in the text file and reads its contents, it will then print out the statistical results to an output file.
 ****************************************************************************
 ***/
 #include "ocean.h"
+#include "ocean-internal.h"
+#include "ocean-render.h"
 #include <iostream> // std::cout
-#include <iomanip>  // std::setw
+#include <string>
 using namespace std;
 
 namespace HLP2 
 {
   namespace WarBoats 
   {
-    int const BOAT_LENGTH {4};  
-    int const HIT_OFFSET  {100}; 
-
 /*!*************************************************************************
 ****
 \brief
@@ -50,17 +53,29 @@ The number of boats
 The size of the grid in the x-direction
 \param y_size
 The size of the grid in the y-direction
+\param layout
+olGRID for one int per cell, olBITBOARD for one bit per cell in two planes
+plus a mask per boat,
+olSPARSE for a hash of the cells under a boat or fired at
 \return
-Ocean pointer
+Ocean pointer, or nullptr if num_boats is negative or over MAX_BOATS (99)
 ****************************************************************************
 ***/
-    Ocean* CreateOcean(int num_boats, int x_size, int y_size) 
+    Ocean* CreateOcean(int num_boats, int x_size, int y_size, OceanLayout layout) 
     {
+      if (num_boats < 0 || num_boats > MAX_BOATS)
+      {
+        return nullptr;
+      }
       Ocean* oceany = new Ocean;
-      oceany->grid = new int[x_size * y_size]();
-      oceany->boats = new Boat[num_boats];
-      oceany->boats->hits = 0;
-      oceany->boats->ID = 0;
+      oceany->layout = layout;
+      oceany->grid = nullptr;
+      oceany->occupied = nullptr;
+      oceany->shot = nullptr;
+      oceany->masks = nullptr;
+      oceany->sparse = nullptr;
+      oceany->image = nullptr;
+      oceany->boats = new Boat[num_boats]();
       oceany->num_boats = num_boats;
       oceany->x_size = x_size;
       oceany->y_size = y_size;
@@ -68,6 +83,18 @@ Ocean pointer
       oceany->stats.misses = 0;
       oceany->stats.duplicates = 0;
       oceany->stats.sunk = 0;
+      if (layout == olBITBOARD)
+      {
+        CreateBitboard(*oceany);
+      }
+      else if (layout == olSPARSE)
+      {
+        CreateSparse(*oceany);
+      }
+      else
+      {
+        oceany->grid = new int[static_cast<std::size_t>(x_size) * static_cast<std::size_t>(y_size)]();
+      }
       return oceany;
     }
 
@@ -84,6 +111,20 @@ void
 ***/
     void DestroyOcean(Ocean *theOcean) 
     {
+      if (theOcean->image)
+      {
+        DestroyImage(*theOcean);
+      }
+      else if (theOcean->layout == olBITBOARD)
+      {
+        DestroyBitboard(*theOcean);
+      }
+      else if (theOcean->layout == olSPARSE)
+      {
+        DestroySparse(*theOcean);
+      }
+      delete [] theOcean->grid;
+      delete [] theOcean->boats;
       delete theOcean;
       return;
     }
@@ -103,47 +144,41 @@ BoatPlacment enum member
 ***/
     BoatPlacement PlaceBoat(Ocean& ocean, Boat const& boat) 
     {
-      if (ocean.boats->ID >= ocean.num_boats)
+      if (ocean.layout == olBITBOARD)
+      {
+        return PlaceBoatBitboard(ocean, boat);
+      }
+      if (ocean.layout == olSPARSE)
+      {
+        return PlaceBoatSparse(ocean, boat);
+      }
+      if (boat.ID < 1 || boat.ID > ocean.num_boats || ocean.boats[boat.ID - 1].ID != 0)
       {
         return bpREJECTED;
       } 
-      if (boat.orientation == oHORIZONTAL) 
+      int dx = (boat.orientation == oHORIZONTAL) ? 1 : 0;
+      int dy = 1 - dx;
+      if (boat.position.x < 0 || boat.position.y < 0 ||
+          boat.position.x + dx * (BOAT_LENGTH - 1) >= ocean.x_size ||
+          boat.position.y + dy * (BOAT_LENGTH - 1) >= ocean.y_size)
       {
-        if ((boat.position.x <= ocean.x_size - BOAT_LENGTH || boat.position.x >= 0) && (boat.position.y <= ocean.y_size || boat.position.y >= 0)) 
-        {
-          for (int i = 0; i < BOAT_LENGTH; i++) 
-          {
-            if (ocean.grid[boat.position.y * ocean.x_size + boat.position.x + i] != 0) 
-            {
-              return bpREJECTED;
-            }  
-          }  
-          ocean.boats->ID++;
-          for (int i = 0; i < BOAT_LENGTH; i++)
-          {
-            ocean.grid[boat.position.y * ocean.x_size + boat.position.x + i] = ocean.boats->ID;
-          } 
-        }
+        return bpREJECTED;
       }
-
-      else if (boat.orientation == oVERTICAL) 
+      int first = boat.position.y * ocean.x_size + boat.position.x;
+      int step = dx + dy * ocean.x_size;
+      for (int i = 0; i < BOAT_LENGTH; i++) 
       {
-        if ((boat.position.y <= ocean.y_size - BOAT_LENGTH || boat.position.y >= 0) && (boat.position.x <= ocean.x_size || boat.position.x >= 0)) 
+        if (ocean.grid[first + i * step] != 0) 
         {
-          for (int i = 0; i < BOAT_LENGTH; i++)
-          {
-            if (ocean.grid[(boat.position.y + i) * ocean.x_size + boat.position.x] != 0)
-            {
-              return bpREJECTED;
-            } 
-          } 
-          ocean.boats->ID++;
-          for (int i = 0; i < BOAT_LENGTH; i++)
-          {
-            ocean.grid[(boat.position.y + i) * ocean.x_size + boat.position.x] = ocean.boats->ID;
-          } 
-        }
-      }
+          return bpREJECTED;
+        }  
+      }  
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        ocean.grid[first + i * step] = boat.ID;
+      } 
+      ocean.boats[boat.ID - 1] = boat;
+      ocean.boats[boat.ID - 1].hits = 0;
       return bpACCEPTED;
     }
 
@@ -162,36 +197,42 @@ ShotResult enum member
 ***/
     ShotResult TakeShot(Ocean& ocean, Point const& coordinate) 
     {
-      if (!((coordinate.x <= ocean.x_size && coordinate.x >= 0) && (coordinate.y <= ocean.y_size && coordinate.y >= 0))) 
+      if (ocean.layout == olBITBOARD)
+      {
+        return TakeShotBitboard(ocean, coordinate);
+      }
+      if (ocean.layout == olSPARSE)
+      {
+        return TakeShotSparse(ocean, coordinate);
+      }
+      if (coordinate.x < 0 || coordinate.x >= ocean.x_size || coordinate.y < 0 || coordinate.y >= ocean.y_size) 
       {
           return srILLEGAL;
       }
       
-      if (ocean.grid[coordinate.y * ocean.x_size + coordinate.x] == dtOK) 
+      int& cell = ocean.grid[coordinate.y * ocean.x_size + coordinate.x];
+      if (cell == dtOK) 
       {
         ocean.stats.misses++;
-        ocean.grid[coordinate.y * ocean.x_size + coordinate.x] = dtBLOWNUP;
+        cell = dtBLOWNUP;
         return srMISS;
       }
 
-      else if ((ocean.grid[coordinate.y * ocean.x_size + coordinate.x] == dtBLOWNUP) || (ocean.grid[coordinate.y * ocean.x_size + coordinate.x] >= 1 + HIT_OFFSET && ocean.grid[coordinate.y * ocean.x_size + coordinate.x] <= 99 + HIT_OFFSET)) 
+      else if (cell == dtBLOWNUP || cell > HIT_OFFSET) 
       {
         ocean.stats.duplicates++;
         return srDUPLICATE;
       }
 
-      else if (ocean.grid[coordinate.y * ocean.x_size + coordinate.x] >= 1 || ocean.grid[coordinate.y * ocean.x_size + coordinate.x] <= 99) 
+      ocean.stats.hits++;
+      Boat& boat = ocean.boats[cell - 1];
+      boat.hits++;
+      cell += HIT_OFFSET;
+      if (boat.hits == BOAT_LENGTH) 
       {
-        ocean.stats.hits++;
-        ocean.boats[ocean.grid[coordinate.y * ocean.x_size + coordinate.x] - 1].hits++;
-        ocean.grid[coordinate.y * ocean.x_size + coordinate.x] += HIT_OFFSET;
-        if (ocean.boats[ocean.grid[coordinate.y * ocean.x_size + coordinate.x] - 101].hits == BOAT_LENGTH) 
-        {
-          ocean.stats.sunk++;
-          return srSUNK;
-        }
+        ocean.stats.sunk++;
+        return srSUNK;
       }
-
       return srHIT;
     }
 
@@ -230,17 +271,62 @@ void
 ****************************************************************************
 ***/
     void DumpOcean(const HLP2::WarBoats::Ocean &ocean, int field_width, bool extraline, bool showboats) {
-      for (int y = 0; y < ocean.y_size; y++) { // For each row
-        for (int x = 0; x < ocean.x_size; x++) { // For each column
-            // Get value at x/y position
-          int value = ocean.grid[y * ocean.x_size + x];
-            // Is it a boat that we need to keep hidden?
-          value = ( (value > 0) && (value < HIT_OFFSET) && (showboats == false) ) ? 0 : value;
-          std::cout << std::setw(field_width) << value;
-        }
-        std::cout << "\n";
-        if (extraline) { std::cout << "\n"; }
-      }
+      DumpOceanView(ocean, Point {0, 0}, ocean.x_size, ocean.y_size, field_width, extraline, showboats);
+    }
+
+/*!*************************************************************************
+****
+\brief
+Prints a rectangle of the ocean, the same way DumpOcean prints all of it.
+An ocean too large to print whole (olSPARSE) can be looked at a window
+at a time. The rectangle is clipped to the ocean. The text is formatted
+into one buffer by an OceanRenderer and written with a single call.
+\param ocean
+The Ocean to print.
+\param origin
+Top-left cell of the rectangle.
+\param columns
+Width of the rectangle in cells.
+\param rows
+Height of the rectangle in cells.
+\param field_width
+How much space each position takes when printed.
+\param extraline
+If true, an extra line is printed after each row.
+\param showboats
+If true, the boats are shown in the output. (Debugging feature)
+\return
+void 
+****************************************************************************
+***/
+    void DumpOceanView(const Ocean &ocean, Point const& origin, int columns, int rows,
+                       int field_width, bool extraline, bool showboats) {
+      OceanRenderer renderer(field_width, extraline, showboats);
+      std::string const& frame = renderer.Frame(ocean, origin, columns, rows);
+      std::cout.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+    }
+
+/*!*************************************************************************
+****
+\brief
+The value the olGRID layout would hold for a cell, whatever the layout:
+0 for open water, dtBLOWNUP for a miss, the boat ID, or the ID plus
+HIT_OFFSET once hit.
+\param ocean
+The ocean to read.
+\param x
+Column of the cell.
+\param y
+Row of the cell.
+\return
+Cell value
+****************************************************************************
+***/
+    int CellValue(Ocean const& ocean, int x, int y)
+    {
+      return (ocean.layout == olBITBOARD) ? CellValueBitboard(ocean, x, y)
+           : (ocean.layout == olSPARSE)   ? CellValueSparse(ocean, x, y)
+                                          : ocean.grid[y * ocean.x_size + x];
     }
   } // namespace WarBoats
-} // namespace HLP2
\ No newline at end of file
+} // namespace HLP2
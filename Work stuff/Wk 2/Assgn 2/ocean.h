@@ -2,6 +2,7 @@
 #ifndef OCEAN_H
 #define OCEAN_H
 ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef> // std::size_t
 
 namespace HLP2 {
   namespace WarBoats {
@@ -31,13 +32,26 @@ namespace HLP2 {
           Point position;
           };
 
+    //! How the cells of an Ocean are stored, chosen at CreateOcean
+    enum OceanLayout { olGRID, olBITBOARD, olSPARSE };
+
+    struct BoatMasks;   //!< olBITBOARD boat masks, defined in ocean-bitboard.cpp
+    struct SparseCells; //!< olSPARSE cell table, defined in ocean-sparse.cpp
+    struct OceanImage;  //!< file mapping of LoadOcean, defined in ocean-image.cpp
+
     struct Ocean {
-          int *grid; 
+          int *grid;                    //!< olGRID: one int per cell
           Boat *boats; 
           int num_boats; 
           int x_size; 
           int y_size; 
           ShotStats stats; 
+          OceanLayout layout;
+          unsigned long long *occupied; //!< olBITBOARD: bit set under a boat
+          unsigned long long *shot;     //!< olBITBOARD: bit set once fired at
+          BoatMasks *masks;             //!< olBITBOARD: cells of each boat, boat of each cell
+          SparseCells *sparse;          //!< olSPARSE: only cells under a boat or fired at
+          OceanImage *image;            //!< LoadOcean: grid and boats live in a mapped file
           };
 
     
@@ -61,15 +75,27 @@ namespace HLP2 {
 
 
       // The interface
-    Ocean* CreateOcean(int num_boats, int x_size, int y_size);
+      // nullptr unless 0 <= num_boats <= 99: a hit cell holds its ID plus
+      // 100, which must not be mistaken for another boat
+    Ocean* CreateOcean(int num_boats, int x_size, int y_size,
+                       OceanLayout layout = olGRID);
     void DestroyOcean(Ocean *theOcean);
     ShotResult TakeShot(Ocean& ocean, Point const& coordinate);
+    void TakeShots(Ocean& ocean, Point const *shots, std::size_t count,
+                   ShotResult *results);
     BoatPlacement PlaceBoat(Ocean& ocean, Boat const& boat);
     ShotStats GetShotStats(Ocean const& ocean);
 
+      // Flat images of an Ocean; LoadOcean maps one copy-on-write, so
+      // loading it many times shares the pages until a branch writes them
+    bool SaveOcean(Ocean const& ocean, char const *filename);
+    Ocean* LoadOcean(char const *filename);   //!< nullptr if not an image
+
       // Provided
     void DumpOcean(const Ocean &ocean, int width = 4, bool extraline = false, 
                    bool showboats = true);
+    void DumpOceanView(const Ocean &ocean, Point const& origin, int columns, int rows,
+                       int width = 4, bool extraline = false, bool showboats = true);
 
   } // namespace WarBoats
 
@@ -0,0 +1,90 @@
+/*!*************************************************************************
+****
+\file prng-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of the PRNG class.
+ The function include:
+- main()
+Times Next() one value at a time against Fill(), and the legacy Random()
+against the unbiased Between(), checks that Fill() and Jump() agree with
+plain Next() calls and prints the time per value
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include "PRNG.h"
+
+namespace {
+
+  using HLP2::Utils::PRNG;
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void report(char const *name, double seconds, std::size_t count, unsigned check) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::setw(8)
+              << seconds * 1e9 / static_cast<double>(count) << " ns   (" << check << ")\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::size_t const count {1 << 24};
+  std::vector<unsigned> values(count);
+  std::cout << std::fixed << std::setprecision(2);
+
+  PRNG one;
+  auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; i++) {
+    values[i] = one.Next();
+  }
+  report("Next()", seconds_since(start), count, values[count - 1]);
+
+  PRNG batch;
+  std::vector<unsigned> filled(count);
+  start = std::chrono::steady_clock::now();
+  batch.Fill(filled.data(), count);
+  report("Fill()", seconds_since(start), count, filled[count - 1]);
+
+  PRNG jumped;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 100'000; i++) {
+    jumped.Jump();
+  }
+  report("Jump()", seconds_since(start), 100'000, jumped.Next());
+
+  PRNG legacy;
+  unsigned sum = 0;
+  start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; i++) {
+    sum += static_cast<unsigned>(legacy.Random(0, 999));
+  }
+  report("Random(0, 999)", seconds_since(start), count, sum);
+
+  PRNG unbiased;
+  sum = 0;
+  start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < count; i++) {
+    sum += static_cast<unsigned>(unbiased.Between(0, 999));
+  }
+  report("Between(0, 999)", seconds_since(start), count, sum);
+
+  PRNG stepped;
+  PRNG leaped;
+  for (int i = 0; i < 12345; i++) {
+    stepped.Next();
+  }
+  leaped.Jump(12345);
+  bool same = values == filled && one.Next() == batch.Next() && stepped.Next() == leaped.Next();
+  std::cout << (same ? "Fill() and Jump() match Next()\n" : "Fill() or Jump() DIFFER from Next()\n");
+  return same ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+/*!*************************************************************************
+****
+\file render-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of OceanRenderer against the iostream DumpOcean loop.
+ The function include:
+- main()
+Plays random shots at oceans of several sizes and, after every batch of
+shots, prints the ocean with one std::setw per cell (the original
+DumpOcean), as one OceanRenderer frame, and as an OceanRenderer diff; it
+checks that the frames match the original text and prints the time and
+bytes per frame; with the argument check it only checks Diff() across
+oceans of one size and different fleets
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "ocean.h"
+#include "ocean-internal.h"
+#include "ocean-render.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // the DumpOcean loop before OceanRenderer
+  void dump_setw(Ocean const& ocean, std::ostream& out) {
+    for (int y = 0; y < ocean.y_size; y++) {
+      for (int x = 0; x < ocean.x_size; x++) {
+        out << std::setw(4) << CellValue(ocean, x, y);
+      }
+      out << "\n";
+    }
+  }
+
+  // what a terminal shows after the ANSI text the renderer writes: the
+  // clear, home and cursor moves of Diff() and plain text
+  void apply_ansi(std::vector<std::string>& screen, std::string const& text) {
+    std::size_t row = 0, column = 0;
+    for (std::size_t i = 0; i < text.size(); i++) {
+      if (text[i] == '\x1b') {
+        std::size_t end = text.find_first_of("HJ", i);
+        std::string args = text.substr(i + 2, end - i - 2);
+        if (text[end] == 'J') {
+          screen.clear();
+        } else if (args.empty()) {
+          row = column = 0;
+        } else {
+          row = std::stoul(args) - 1;
+          column = std::stoul(args.substr(args.find(';') + 1)) - 1;
+        }
+        i = end;
+      } else if (text[i] == '\n') {
+        row++;
+        column = 0;
+      } else {
+        if (screen.size() <= row) {
+          screen.resize(row + 1);
+        }
+        if (screen[row].size() <= column) {
+          screen[row].resize(column + 1, ' ');
+        }
+        screen[row][column++] = text[i];
+      }
+    }
+  }
+
+  // a 10x10 ocean with boats 1..num_boats along the rows, all of them hit
+  Ocean *hit_fleet(int num_boats) {
+    Ocean *ocean = CreateOcean(num_boats, 10, 10);
+    for (int id = 1; id <= num_boats; id++) {
+      PlaceBoat(*ocean, Boat {0, id, oHORIZONTAL, Point {0, id - 1}});
+      for (int x = 0; x < BOAT_LENGTH; x++) {
+        TakeShot(*ocean, Point {x, id - 1});
+      }
+    }
+    return ocean;
+  }
+
+  // Diff() of a small fleet then of a larger one in an ocean of the same
+  // size must leave the terminal showing the larger one
+  bool check_diff() {
+    Ocean *small = hit_fleet(1);
+    Ocean *large = hit_fleet(9);
+    OceanRenderer renderer;
+    std::vector<std::string> screen;
+    apply_ansi(screen, renderer.Diff(*small));
+    apply_ansi(screen, renderer.Diff(*large));
+    std::ostringstream expected, shown;
+    dump_setw(*large, expected);
+    for (std::string const& line : screen) {
+      shown << line << "\n";
+    }
+    DestroyOcean(small);
+    DestroyOcean(large);
+    bool same = expected.str() == shown.str();
+    std::cout << "Diff after a larger fleet: " << (same ? "match" : "DIFFER") << "\n";
+    return same;
+  }
+
+  void run(int size, int frames, int shots_per_frame) {
+    PRNG random(static_cast<unsigned>(size), 5);
+    int num_boats = 99;
+    Ocean *ocean = CreateOcean(num_boats, size, size);
+    for (int id = 1; id <= num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = random.Between(0, size - 1);
+        boat.position.y = random.Between(0, size - 1);
+      } while (PlaceBoat(*ocean, boat) == bpREJECTED);
+    }
+
+    std::ofstream sink("/dev/null", std::ios_base::binary);
+    OceanRenderer frames_renderer;
+    OceanRenderer diff_renderer;
+    double setw_time = 0.0, frame_time = 0.0, diff_time = 0.0;
+    long long frame_bytes = 0, diff_bytes = 0;
+    bool same = true;
+    for (int f = 0; f < frames; f++) {
+      for (int s = 0; s < shots_per_frame; s++) {
+        TakeShot(*ocean, Point {random.Between(0, size - 1), random.Between(0, size - 1)});
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      dump_setw(*ocean, sink);
+      setw_time += seconds_since(start);
+
+      start = std::chrono::steady_clock::now();
+      std::string const& frame = frames_renderer.Frame(*ocean);
+      sink.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+      frame_time += seconds_since(start);
+      frame_bytes += static_cast<long long>(frame.size());
+
+      start = std::chrono::steady_clock::now();
+      std::string const& diff = diff_renderer.Diff(*ocean);
+      sink.write(diff.data(), static_cast<std::streamsize>(diff.size()));
+      diff_time += seconds_since(start);
+      diff_bytes += static_cast<long long>(diff.size());
+
+      if (f == 0 || f == frames - 1) {
+        std::ostringstream expected;
+        dump_setw(*ocean, expected);
+        same = same && expected.str() == frame;
+      }
+    }
+    DestroyOcean(ocean);
+
+    std::cout << std::setw(5) << size << "x" << std::left << std::setw(5) << size << std::right
+              << std::setw(7) << frames
+              << std::setw(12) << setw_time * 1e6 / frames
+              << std::setw(12) << frame_time * 1e6 / frames
+              << std::setw(12) << diff_time * 1e6 / frames
+              << std::setw(12) << frame_bytes / frames
+              << std::setw(12) << diff_bytes / frames
+              << (same ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main(int argc, char *argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "check") {
+    return check_diff() ? 0 : 1;
+  }
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "      ocean frames     setw us    frame us     diff us frame bytes  diff bytes\n";
+  run(30, 2000, 5);
+  run(100, 500, 20);
+  run(1'000, 20, 1000);
+}
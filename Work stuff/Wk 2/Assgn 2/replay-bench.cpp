@@ -0,0 +1,140 @@
+/*!*************************************************************************
+****
+\file replay-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of game logs and their replay.
+ The function include:
+- main()
+Records a corpus of random-shot and DensitySolver games in one log,
+replays it in each Ocean layout, then flips one recorded result and
+checks that the replay finds it; prints the log size and shots per second
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstdio>   // std::remove
+#include "ocean.h"
+#include "game-log.h"
+#include "solver.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  char const LOG_FILE[] {"replay-bench.wbgl"};
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  Ocean* random_fleet(PRNG& random, int num_boats, int size) {
+    Ocean *ocean = CreateOcean(num_boats, size, size);
+    for (int id = 1; id <= num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = random.Between(0, size - 1);
+        boat.position.y = random.Between(0, size - 1);
+      } while (PlaceBoat(*ocean, boat) == bpREJECTED);
+    }
+    return ocean;
+  }
+
+  // random shots as in test_rect, with duplicates, until the fleet is sunk
+  void record_random(PRNG& random, int num_boats, int size, std::ostream& out) {
+    Ocean *ocean = random_fleet(random, num_boats, size);
+    GameLog log(*ocean);
+    for (int sunk = 0; sunk < num_boats; ) {
+      Point shot {random.Between(0, size - 1), random.Between(0, size - 1)};
+      ShotResult result = TakeShot(*ocean, shot);
+      log.Record(shot, result);
+      sunk += result == srSUNK;
+    }
+    log.Write(out, GetShotStats(*ocean));
+    DestroyOcean(ocean);
+  }
+
+  void record_solver(PRNG& random, int num_boats, int size, std::ostream& out) {
+    Ocean *ocean = random_fleet(random, num_boats, size);
+    GameLog log(*ocean);
+    DensitySolver solver(size, size);
+    for (int sunk = 0; sunk < num_boats; ) {
+      Point shot = solver.Next();
+      ShotResult result = TakeShot(*ocean, shot);
+      solver.Record(shot, result);
+      log.Record(shot, result);
+      sunk += result == srSUNK;
+    }
+    log.Write(out, GetShotStats(*ocean));
+    DestroyOcean(ocean);
+  }
+
+  void replay(char const *name, OceanLayout layout) {
+    auto start = std::chrono::steady_clock::now();
+    ReplayReport report = ReplayGames(LOG_FILE, layout);
+    double seconds = seconds_since(start);
+    std::cout << std::setw(10) << name << std::setw(8) << report.games << std::setw(11) << report.shots
+              << std::setw(10) << report.mismatched_shots << std::setw(8) << report.mismatched_games
+              << std::setw(10) << seconds * 1e3
+              << std::setw(12) << static_cast<double>(report.shots) / seconds / 1e6
+              << (report.complete ? "" : "   INCOMPLETE") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  PRNG random(2026, 10);
+  auto start = std::chrono::steady_clock::now();
+  {
+    std::ofstream out(LOG_FILE, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    for (int g = 0; g < 20'000; g++) {
+      record_random(random, 5, 10, out);
+    }
+    for (int g = 0; g < 50; g++) {
+      record_random(random, 50, 100, out);
+    }
+    for (int g = 0; g < 2'000; g++) {
+      record_solver(random, 5, 10, out);
+    }
+  }
+  double record_time = seconds_since(start);
+  std::ifstream size_of(LOG_FILE, std::ios_base::binary | std::ios_base::ate);
+  long long bytes = static_cast<long long>(size_of.tellg());
+  size_of.close();
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "recorded " << bytes << " bytes in " << record_time * 1e3 << " ms\n";
+  std::cout << "    layout   games      shots  bad shots bad games       ms  Mshots/s\n";
+  replay("grid", olGRID);
+  replay("bitboard", olBITBOARD);
+  replay("sparse", olSPARSE);
+
+    // flip the result of the first shot of the first game: MISS <-> HIT
+  {
+    std::fstream log(LOG_FILE, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    GameLogHeader header;
+    log.read(reinterpret_cast<char*>(&header), sizeof(header));
+    std::streamoff first_shot = static_cast<std::streamoff>(sizeof(header) + header.num_boats * sizeof(GameLogBoat));
+    unsigned shot;
+    log.seekg(first_shot);
+    log.read(reinterpret_cast<char*>(&shot), sizeof(shot));
+    shot ^= 1;
+    log.seekp(first_shot);
+    log.write(reinterpret_cast<char const*>(&shot), sizeof(shot));
+  }
+  ReplayReport report = ReplayGames(LOG_FILE);
+  std::cout << "one result flipped: " << report.mismatched_games << " bad game (game "
+            << report.first_bad_game << "), " << report.mismatched_shots << " bad shot\n";
+  std::remove(LOG_FILE);
+}
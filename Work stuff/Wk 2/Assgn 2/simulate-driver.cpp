@@ -0,0 +1,68 @@
+// Monte Carlo driver for WarBoats: plays many random games and prints the
+// shots-to-win distribution. The report on stdout depends only on the
+// arguments; the timing goes to stderr so runs can be diffed.
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include "simulate.h"
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    std::cout << "Usage: ./simulate.out games threads [seed] [x-size y-size boats] [grid|bitboard|sparse]\n";
+    return 0;
+  }
+
+  HLP2::WarBoats::SimulationConfig config {5, 10, 10, HLP2::WarBoats::olGRID, 1, 0, 0};
+  config.games = std::stoll(argv[1]);
+  config.num_threads = static_cast<unsigned>(std::stoul(argv[2]));
+  if (argc > 3) {
+    config.seed = std::stoull(argv[3]);
+  }
+  if (argc > 6) {
+    config.x_size = std::stoi(argv[4]);
+    config.y_size = std::stoi(argv[5]);
+    config.num_boats = std::stoi(argv[6]);
+  }
+  if (argc > 7 && std::string(argv[7]) == "bitboard") {
+    config.layout = HLP2::WarBoats::olBITBOARD;
+  }
+  if (argc > 7 && std::string(argv[7]) == "sparse") {
+    config.layout = HLP2::WarBoats::olSPARSE;
+  }
+
+  HLP2::WarBoats::SimulationResult result = HLP2::WarBoats::Simulate(config);
+  double games = static_cast<double>(result.games);
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << result.games << " games, " << config.num_boats << " boats, "
+            << config.x_size << "x" << config.y_size << ", seed " << config.seed << "\n";
+  if (result.unplaced) {
+    std::cout << result.unplaced << " games not played: the fleet could not be placed\n";
+    if (result.games == 0) {
+      return 0;
+    }
+  }
+  std::cout << "      Hits: " << result.hits << "\n";
+  std::cout << "    Misses: " << result.misses << "\n";
+  std::cout << "Duplicates: " << result.duplicates << "\n";
+  std::cout << "Boats Sunk: " << result.sunk << "\n";
+  std::cout << "Mean shots to sink boat:\n";
+  for (std::size_t k = 0; k < result.shots_to_sink.size(); k++) {
+    std::cout << std::setw(6) << k + 1 << std::setw(12) << static_cast<double>(result.shots_to_sink[k]) / games << "\n";
+  }
+  std::cout << "Shots to win (percentiles):\n";
+  double const percentiles[] {0.10, 0.25, 0.50, 0.75, 0.90, 0.99, 1.00};
+  long long seen = 0;
+  std::size_t p = 0;
+  for (std::size_t n = 0; n < result.shots_to_win.size() && p < 7; n++) {
+    seen += result.shots_to_win[n];
+    while (p < 7 && static_cast<double>(seen) >= percentiles[p] * games) {
+      std::cout << std::setw(6) << static_cast<int>(percentiles[p] * 100) << "%" << std::setw(11) << n << "\n";
+      p++;
+    }
+  }
+
+  std::cerr << std::fixed << std::setprecision(0)
+            << games / result.seconds << " games/s (" << std::setprecision(3) << result.seconds << " s)\n";
+}
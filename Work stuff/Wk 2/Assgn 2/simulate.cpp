@@ -0,0 +1,180 @@
+/*!*************************************************************************
+****
+\file simulate.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Monte Carlo simulation of many independent WarBoats games.
+ The function include:
+- Simulate
+Plays the games on a pool of threads and adds up their statistics
+****************************************************************************
+***/
+#include "simulate.h"
+#include "fleet.h"
+#include "ocean-internal.h"
+#include "PRNG.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional> // std::cref, std::ref
+#include <thread>
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+  long long const GAMES_PER_CLAIM {64};
+
+  void AddStats(SimulationResult& into, ShotStats const& from)
+  {
+    into.hits += from.hits;
+    into.misses += from.misses;
+    into.duplicates += from.duplicates;
+    into.sunk += from.sunk;
+  }
+
+  void PlayGame(SimulationConfig const& config, long long game, SimulationResult& result)
+  {
+      // game g plays on the g-th substream of the run seed, so games never
+      // share state and a game plays the same on any thread
+    HLP2::Utils::PRNG random(static_cast<unsigned>(config.seed), static_cast<unsigned>(config.seed >> 32));
+    random.Jump(static_cast<unsigned long long>(game) * HLP2::Utils::PRNG::JUMP_STEPS);
+    Ocean *ocean = CreateOcean(config.num_boats, config.x_size, config.y_size, config.layout);
+
+      // a sparse fleet is drawn exactly as the PlaceBoat retry loop did; a
+      // crowded one may find no room in PlaceFleet's attempts and is skipped
+    if (PlaceFleet(*ocean, random) == bpREJECTED)
+    {
+      result.unplaced++;
+      DestroyOcean(ocean);
+      return;
+    }
+
+    long long shots = 0;
+    int sunk = 0;
+    while (sunk < config.num_boats)
+    {
+      Point coordinate {random.Between(0, config.x_size - 1), random.Between(0, config.y_size - 1)};
+      shots++;
+      if (TakeShot(*ocean, coordinate) == srSUNK)
+      {
+        result.shots_to_sink[static_cast<std::size_t>(sunk++)] += shots;
+      }
+    }
+
+    if (result.shots_to_win.size() <= static_cast<std::size_t>(shots))
+    {
+      result.shots_to_win.resize(static_cast<std::size_t>(shots) + 1, 0);
+    }
+    result.shots_to_win[static_cast<std::size_t>(shots)]++;
+    result.games++;
+    AddStats(result, GetShotStats(*ocean));
+    DestroyOcean(ocean);
+  }
+
+    // claims blocks of games until none are left
+  void Worker(SimulationConfig const& config, std::atomic<long long>& next, SimulationResult& result)
+  {
+    for (long long first = next.fetch_add(GAMES_PER_CLAIM); first < config.games;
+         first = next.fetch_add(GAMES_PER_CLAIM))
+    {
+      long long last = std::min(first + GAMES_PER_CLAIM, config.games);
+      for (long long game = first; game < last; game++)
+      {
+        PlayGame(config, game, result);
+      }
+    }
+  }
+
+  SimulationResult EmptyResult(SimulationConfig const& config)
+  {
+    SimulationResult result {};
+    result.shots_to_sink.assign(static_cast<std::size_t>(std::max(config.num_boats, 0)), 0);
+    return result;
+  }
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Plays config.games random games. Each game places its fleet with
+PlaceFleet and fires until every boat is sunk, drawing all its random numbers from its own
+substream of the run seed (PRNG::Jump), so a game plays the same on any
+thread. Every worker keeps its own counters, which are added up at
+the end; since the totals are integer sums, the result for a seed does
+not depend on the thread count or on the order the games ran in.
+\param config
+Fleet, ocean size and layout, seed, number of games and of threads
+\return
+Totals over all the games; a fleet of more than MAX_BOATS boats, or more
+than MaxFleet fits in the ocean, plays no game and counts them all as
+unplaced
+****************************************************************************
+***/
+    SimulationResult Simulate(SimulationConfig const& config)
+    {
+      if (config.num_boats < 0 || config.num_boats > MAX_BOATS ||
+          config.num_boats > MaxFleet(config.x_size, config.y_size))
+      {
+        SimulationResult result = EmptyResult(config);
+        result.unplaced = config.games;
+        return result;
+      }
+
+      unsigned num_threads = config.num_threads;
+      if (num_threads == 0)
+      {
+        num_threads = std::thread::hardware_concurrency();
+        num_threads = num_threads ? num_threads : 1;
+      }
+
+      auto start = std::chrono::steady_clock::now();
+      std::vector<SimulationResult> partial(num_threads, EmptyResult(config));
+      std::atomic<long long> next {0};
+      std::vector<std::thread> workers;
+      for (unsigned i = 1; i < num_threads; i++)
+      {
+        workers.emplace_back(Worker, std::cref(config), std::ref(next), std::ref(partial[i]));
+      }
+      Worker(config, next, partial[0]);
+      for (std::thread& worker : workers)
+      {
+        worker.join();
+      }
+
+      SimulationResult result = EmptyResult(config);
+      for (SimulationResult const& part : partial)
+      {
+        result.games += part.games;
+        result.hits += part.hits;
+        result.misses += part.misses;
+        result.duplicates += part.duplicates;
+        result.sunk += part.sunk;
+        result.unplaced += part.unplaced;
+        for (std::size_t k = 0; k < part.shots_to_sink.size(); k++)
+        {
+          result.shots_to_sink[k] += part.shots_to_sink[k];
+        }
+        if (result.shots_to_win.size() < part.shots_to_win.size())
+        {
+          result.shots_to_win.resize(part.shots_to_win.size(), 0);
+        }
+        for (std::size_t n = 0; n < part.shots_to_win.size(); n++)
+        {
+          result.shots_to_win[n] += part.shots_to_win[n];
+        }
+      }
+      result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      return result;
+    }
+  } // namespace WarBoats
+} // namespace HLP2
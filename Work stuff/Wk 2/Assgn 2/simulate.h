@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMULATE_H
+#define SIMULATE_H
+////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! What to simulate: random fleets sunk by random shots, as in test_rect
+    struct SimulationConfig {
+      int num_boats;
+      int x_size;
+      int y_size;
+      OceanLayout layout;
+      unsigned long long seed;  //!< every game draws from its own stream of this seed
+      long long games;
+      unsigned num_threads;     //!< 0 picks the number of hardware threads
+    };
+
+      //! Totals over all games; the same for a seed whatever the thread count
+    struct SimulationResult {
+      long long games;
+      std::vector<long long> shots_to_win;   //!< [n]: games won on shot n
+      std::vector<long long> shots_to_sink;  //!< [k]: shots summed over games until k+1 boats were sunk
+      long long hits;                        //!< ShotStats added over all games,
+      long long misses;                      //!< 64-bit since millions of games
+      long long duplicates;                  //!< overflow an int
+      long long sunk;
+      long long unplaced;                    //!< games not played: PlaceFleet could not place the fleet
+      double seconds;                        //!< wall time of the run
+    };
+
+    SimulationResult Simulate(SimulationConfig const& config);
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // SIMULATE_H
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,113 @@
+/*!*************************************************************************
+****
+\file solver-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of the DensitySolver against random shots.
+ The function include:
+- main()
+Plays the same random fleets with the solver and with random shots (as in
+test_rect) on oceans from 10x10 to 1000x1000, and prints the mean shots to
+win and the time per solver shot (solver and TakeShot together)
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include "ocean.h"
+#include "solver.h"
+#include "PRNG.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+  using HLP2::Utils::PRNG;
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  Ocean* RandomFleet(PRNG& random, int num_boats, int size) {
+    Ocean *ocean = CreateOcean(num_boats, size, size);
+    for (int id = 1; id <= num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = random.Between(0, 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = random.Between(0, size - 1);
+        boat.position.y = random.Between(0, size - 1);
+      } while (PlaceBoat(*ocean, boat) == bpREJECTED);
+    }
+    return ocean;
+  }
+
+  // shots the solver needs to sink the fleet; the time covers the solver
+  // and TakeShot() together since a clock read per shot would cost more
+  // than the shot
+  long long SolverGame(Ocean& ocean, int num_boats, int size, double& solver_seconds) {
+    auto start = std::chrono::steady_clock::now();
+    DensitySolver solver(size, size);
+    long long shots = 0;
+    for (int sunk = 0; sunk < num_boats; shots++) {
+      Point shot = solver.Next();
+      ShotResult result = TakeShot(ocean, shot);
+      solver.Record(shot, result);
+      sunk += result == srSUNK;
+    }
+    solver_seconds += seconds_since(start);
+    return shots;
+  }
+
+  long long RandomGame(PRNG& random, Ocean& ocean, int num_boats, int size) {
+    long long shots = 0;
+    for (int sunk = 0; sunk < num_boats; shots++) {
+      Point shot {random.Between(0, size - 1), random.Between(0, size - 1)};
+      sunk += TakeShot(ocean, shot) == srSUNK;
+    }
+    return shots;
+  }
+
+  void run(int size, int num_boats, int games, bool with_random) {
+    PRNG random(size, num_boats);
+    long long solver_shots = 0;
+    long long random_shots = 0;
+    double solver_seconds = 0.0;
+    for (int g = 0; g < games; g++) {
+      PRNG fleet_random = random;
+      Ocean *ocean = RandomFleet(random, num_boats, size);
+      solver_shots += SolverGame(*ocean, num_boats, size, solver_seconds);
+      DestroyOcean(ocean);
+      if (with_random) {
+        ocean = RandomFleet(fleet_random, num_boats, size);
+        random_shots += RandomGame(random, *ocean, num_boats, size);
+        DestroyOcean(ocean);
+      }
+    }
+
+    std::cout << std::setw(5) << size << "x" << std::left << std::setw(5) << size << std::right
+              << std::setw(6) << num_boats << std::setw(7) << games
+              << std::setw(14) << static_cast<double>(solver_shots) / games;
+    if (with_random) {
+      std::cout << std::setw(14) << static_cast<double>(random_shots) / games;
+    } else {
+      std::cout << std::setw(14) << "-";
+    }
+    std::cout << std::setw(12) << solver_seconds * 1e9 / static_cast<double>(solver_shots) << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "    ocean  boats  games  solver shots  random shots  ns/shot\n";
+  run(10, 5, 2000, true);
+  run(32, 20, 400, true);
+  run(100, 50, 50, true);
+  run(316, 99, 5, false);
+  run(1000, 99, 1, false);
+}
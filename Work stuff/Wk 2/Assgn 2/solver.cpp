@@ -0,0 +1,322 @@
+/*!*************************************************************************
+****
+\file solver.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Probability density hunt/target shooter for WarBoats.
+ The function include:
+- DensitySolver::DensitySolver
+Scores every cell of an empty ocean by the boat placements over it
+- DensitySolver::Next
+Picks an open cell with the best score
+- DensitySolver::Record
+Rescores the placements through a cell from the result of its shot
+****************************************************************************
+***/
+#include "solver.h"
+#include "ocean-internal.h"
+
+namespace
+{
+  using namespace HLP2::WarBoats;
+
+    // a placement holding unsunk hits must outscore every hunting cell: a
+    // cell lies under at most 2 * BOAT_LENGTH placements of weight 1
+  int const TARGET_WEIGHT {2 * BOAT_LENGTH + 1};
+  int const MAX_SCORE {2 * BOAT_LENGTH * (1 + TARGET_WEIGHT * (BOAT_LENGTH - 1))};
+  int const NONE {-1};
+}
+
+namespace HLP2
+{
+  namespace WarBoats
+  {
+/*!*************************************************************************
+****
+\brief
+Starts a game on an empty ocean: every placement that fits is legal, so a
+cell scores the number of boat placements that would cover it.
+\param x_size
+Width of the ocean
+\param y_size
+Height of the ocean
+****************************************************************************
+***/
+    DensitySolver::DensitySolver(int x_size, int y_size)
+      : x_size(x_size), y_size(y_size),
+        state(static_cast<std::size_t>(x_size) * static_cast<std::size_t>(y_size), csOPEN),
+        score(state.size(), 0),
+        legal(2 * state.size(), 0),
+        hits(2 * state.size(), 0),
+        bucket_head(MAX_SCORE + 1, NONE),
+        next(state.size(), NONE),
+        prev(state.size(), NONE),
+        top(0)
+    {
+      for (int y = 0; y < y_size; y++)
+      {
+        for (int x = 0; x < x_size; x++)
+        {
+          int cell = y * x_size + x;
+          if (x + BOAT_LENGTH <= x_size)
+          {
+            legal[2 * cell] = 1;
+            for (int i = 0; i < BOAT_LENGTH; i++)
+            {
+              score[cell + i]++;
+            }
+          }
+          if (y + BOAT_LENGTH <= y_size)
+          {
+            legal[2 * cell + 1] = 1;
+            for (int i = 0; i < BOAT_LENGTH; i++)
+            {
+              score[cell + i * x_size]++;
+            }
+          }
+        }
+      }
+        // linked back to front so ties go to the top-left cell first
+      for (int cell = static_cast<int>(state.size()) - 1; cell >= 0; cell--)
+      {
+        Link(cell);
+      }
+    }
+
+/*!*************************************************************************
+****
+\brief
+Picks the next shot. The buckets above top are empty, so only empty
+buckets that top has to step down over cost anything; top only rises by
+what Record() added, which keeps the search amortized O(1) per shot.
+\return
+An open cell with the best score, or (-1, -1) once every cell was shot
+****************************************************************************
+***/
+    Point DensitySolver::Next() const
+    {
+      while (top > 0 && bucket_head[top] == NONE)
+      {
+        top--;
+      }
+      int cell = bucket_head[top];
+      if (cell == NONE)
+      {
+        return Point {-1, -1};
+      }
+      return Point {cell % x_size, cell / x_size};
+    }
+
+/*!*************************************************************************
+****
+\brief
+Updates the scores with the result of a shot. Only the placements through
+the shot cell change, at most 2 * BOAT_LENGTH of them:
+ - a miss makes them illegal
+ - a hit adds to the unsunk hits they hold
+ - a sunk boat is a hit, then the boat's cells are taken out like misses
+\param shot
+Cell that was fired at
+\param result
+What TakeShot() returned for it
+****************************************************************************
+***/
+    void DensitySolver::Record(Point const& shot, ShotResult result)
+    {
+      if (shot.x < 0 || shot.x >= x_size || shot.y < 0 || shot.y >= y_size)
+      {
+        return;
+      }
+      int cell = shot.y * x_size + shot.x;
+      if (state[static_cast<std::size_t>(cell)] != csOPEN)
+      {
+        return;
+      }
+      Unlink(cell);
+
+      switch (result)
+      {
+        case srHIT:
+          HitAt(cell);
+          break;
+        case srSUNK:
+          HitAt(cell);
+          MarkSunk(cell);
+          break;
+        default:
+          state[static_cast<std::size_t>(cell)] = csMISS;
+          Block(cell);
+          break;
+      }
+    }
+
+      // calls f(placement) for every placement that fits and covers cell
+    template <typename F>
+    void DensitySolver::ForPlacementsThrough(int cell, F f) const
+    {
+      int x = cell % x_size;
+      int y = cell / x_size;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        if (x - i >= 0 && x - i + BOAT_LENGTH <= x_size)
+        {
+          f(2 * (cell - i));
+        }
+        if (y - i >= 0 && y - i + BOAT_LENGTH <= y_size)
+        {
+          f(2 * (cell - i * x_size) + 1);
+        }
+      }
+    }
+
+    int DensitySolver::Weight(int placement) const
+    {
+      std::size_t p = static_cast<std::size_t>(placement);
+      return legal[p] ? 1 + TARGET_WEIGHT * hits[p] : 0;
+    }
+
+    void DensitySolver::SetPlacement(int placement, bool is_legal, int num_hits)
+    {
+      int old_weight = Weight(placement);
+      legal[static_cast<std::size_t>(placement)] = is_legal;
+      hits[static_cast<std::size_t>(placement)] = static_cast<unsigned char>(num_hits);
+      int delta = Weight(placement) - old_weight;
+      if (delta == 0)
+      {
+        return;
+      }
+      int first = placement / 2;
+      int step = (placement & 1) ? x_size : 1;
+      for (int i = 0; i < BOAT_LENGTH; i++)
+      {
+        AddScore(first + i * step, delta);
+      }
+    }
+
+    void DensitySolver::AddScore(int cell, int delta)
+    {
+      bool open = state[static_cast<std::size_t>(cell)] == csOPEN;
+      if (open)
+      {
+        Unlink(cell);
+      }
+      score[static_cast<std::size_t>(cell)] += delta;
+      if (open)
+      {
+        Link(cell);
+      }
+    }
+
+    void DensitySolver::Link(int cell)
+    {
+      std::size_t c = static_cast<std::size_t>(cell);
+      int s = score[c];
+      prev[c] = NONE;
+      next[c] = bucket_head[static_cast<std::size_t>(s)];
+      if (next[c] != NONE)
+      {
+        prev[static_cast<std::size_t>(next[c])] = cell;
+      }
+      bucket_head[static_cast<std::size_t>(s)] = cell;
+      if (s > top)
+      {
+        top = s;
+      }
+    }
+
+    void DensitySolver::Unlink(int cell)
+    {
+      std::size_t c = static_cast<std::size_t>(cell);
+      if (prev[c] != NONE)
+      {
+        next[static_cast<std::size_t>(prev[c])] = next[c];
+      }
+      else
+      {
+        bucket_head[static_cast<std::size_t>(score[c])] = next[c];
+      }
+      if (next[c] != NONE)
+      {
+        prev[static_cast<std::size_t>(next[c])] = prev[c];
+      }
+    }
+
+    void DensitySolver::HitAt(int cell)
+    {
+      state[static_cast<std::size_t>(cell)] = csHIT;
+      ForPlacementsThrough(cell, [this](int p) {
+        if (legal[static_cast<std::size_t>(p)])
+        {
+          SetPlacement(p, true, hits[static_cast<std::size_t>(p)] + 1);
+        }
+      });
+    }
+
+      // no boat can lie over cell any more
+    void DensitySolver::Block(int cell)
+    {
+      ForPlacementsThrough(cell, [this](int p) {
+        SetPlacement(p, false, 0);
+      });
+    }
+
+      // The shot only says some boat through cell sank, so its cells are
+      // guessed as a run of BOAT_LENGTH unsunk hits through cell, across
+      // first. A wrong guess next to another boat only costs shots.
+    void DensitySolver::MarkSunk(int cell)
+    {
+      int x = cell % x_size;
+      int y = cell / x_size;
+      auto is_hit = [this](int c) { return state[static_cast<std::size_t>(c)] == csHIT; };
+
+      int left = x;
+      while (left > 0 && is_hit(cell - (x - left) - 1))
+      {
+        left--;
+      }
+      int right = x;
+      while (right + 1 < x_size && is_hit(cell + (right - x) + 1))
+      {
+        right++;
+      }
+      int up = y;
+      while (up > 0 && is_hit(cell - (y - up + 1) * x_size))
+      {
+        up--;
+      }
+      int down = y;
+      while (down + 1 < y_size && is_hit(cell + (down - y + 1) * x_size))
+      {
+        down++;
+      }
+
+      int first = cell;
+      int step = 1;
+      int count = 1;
+      if (right - left + 1 >= BOAT_LENGTH)
+      {
+        int start = x - BOAT_LENGTH + 1 > left ? x - BOAT_LENGTH + 1 : left;
+        first = y * x_size + start;
+        count = BOAT_LENGTH;
+      }
+      else if (down - up + 1 >= BOAT_LENGTH)
+      {
+        int start = y - BOAT_LENGTH + 1 > up ? y - BOAT_LENGTH + 1 : up;
+        first = start * x_size + x;
+        step = x_size;
+        count = BOAT_LENGTH;
+      }
+      for (int i = 0; i < count; i++)
+      {
+        state[static_cast<std::size_t>(first + i * step)] = csSUNK;
+        Block(first + i * step);
+      }
+    }
+
+  } // namespace WarBoats
+} // namespace HLP2
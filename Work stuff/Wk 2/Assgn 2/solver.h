@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SOLVER_H
+#define SOLVER_H
+////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include "ocean.h"
+
+namespace HLP2 {
+  namespace WarBoats {
+
+      //! Hunt/target shooter. Every cell scores the boat placements that
+      //! could still cover it, each placement weighted up by the unsunk hits
+      //! it already holds; Next() fires at the best scoring open cell.
+      //! Record() rescores only the placements through the cell just shot.
+    class DensitySolver {
+    public:
+      DensitySolver(int x_size, int y_size);
+
+      Point Next() const;                                  //!< best open cell
+      void Record(Point const& shot, ShotResult result);   //!< result of a shot
+
+    private:
+      enum CellState : unsigned char { csOPEN, csMISS, csHIT, csSUNK };
+
+      int Weight(int placement) const;
+      void SetPlacement(int placement, bool legal, int hits);
+      void AddScore(int cell, int delta);
+      void Link(int cell);
+      void Unlink(int cell);
+      void HitAt(int cell);
+      void Block(int cell);
+      void MarkSunk(int cell);
+      template <typename F> void ForPlacementsThrough(int cell, F f) const;
+
+      int x_size;
+      int y_size;
+      std::vector<CellState> state;
+      std::vector<int> score;               //!< sum of the weights of placements over the cell
+        // placements are numbered 2 * first cell + orientation
+      std::vector<unsigned char> legal;     //!< no miss or sunk boat under it
+      std::vector<unsigned char> hits;      //!< unsunk hits under it
+        // open cells bucketed by score, as doubly linked lists
+      std::vector<int> bucket_head;
+      std::vector<int> next;
+      std::vector<int> prev;
+      mutable int top;                      //!< no open cell scores above this
+    };
+
+  } // namespace WarBoats
+} // namespace HLP2
+
+#endif // SOLVER_H
+////////////////////////////////////////////////////////////////////////////////
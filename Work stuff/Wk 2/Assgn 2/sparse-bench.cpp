@@ -0,0 +1,111 @@
+/*!*************************************************************************
+****
+\file sparse-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Assignment 2: Battleship
+\date 17-10-2026
+\brief
+Benchmark of the olSPARSE Ocean layout against the dense olGRID.
+ The function include:
+- main()
+Places 99 boats in oceans of several sizes and fires random shots at
+0.1%, 1% and 10% of the cells, checks that the two layouts give the same
+results, and prints the time per shot and the bytes used by the cells.
+Oceans too large for a dense grid are run with olSPARSE alone
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include "ocean.h"
+#include "ocean-internal.h"
+
+namespace {
+
+  using namespace HLP2::WarBoats;
+
+  int const NUM_BOATS {99};
+
+  unsigned long long next_rand(unsigned long long& state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state >> 17;
+  }
+
+  void place_fleet(Ocean& ocean, unsigned long long seed) {
+    for (int id = 1; id <= ocean.num_boats; id++) {
+      Boat boat;
+      boat.ID = id;
+      do {
+        boat.orientation = (next_rand(seed) & 1) ? oHORIZONTAL : oVERTICAL;
+        boat.position.x = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.x_size));
+        boat.position.y = static_cast<int>(next_rand(seed) % static_cast<unsigned>(ocean.y_size));
+      } while (PlaceBoat(ocean, boat) == bpREJECTED);
+    }
+  }
+
+  double fire(Ocean& ocean, std::vector<Point> const& shots, std::vector<ShotResult>& results) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < shots.size(); i++) {
+      results[i] = TakeShot(ocean, shots[i]);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  void run(int size, double density, bool with_grid) {
+    long long cells = static_cast<long long>(size) * size;
+    std::size_t num_shots = static_cast<std::size_t>(static_cast<double>(cells) * density);
+    std::vector<Point> shots(num_shots);
+    unsigned long long seed = 99;
+    for (Point& p : shots) {
+      p.x = static_cast<int>(next_rand(seed) % static_cast<unsigned>(size));
+      p.y = static_cast<int>(next_rand(seed) % static_cast<unsigned>(size));
+    }
+
+    Ocean *sparse = CreateOcean(NUM_BOATS, size, size, olSPARSE);
+    place_fleet(*sparse, 7);
+    std::vector<ShotResult> sparse_results(num_shots);
+    double sparse_time = fire(*sparse, shots, sparse_results);
+    ShotStats b = GetShotStats(*sparse);
+
+    std::cout << std::setw(6) << size << "x" << std::left << std::setw(6) << size << std::right
+              << std::setw(7) << std::setprecision(3) << density * 100 << "%" << std::setprecision(1) << std::setw(10) << num_shots;
+    if (with_grid) {
+      Ocean *grid = CreateOcean(NUM_BOATS, size, size, olGRID);
+      place_fleet(*grid, 7);
+      std::vector<ShotResult> grid_results(num_shots);
+      double grid_time = fire(*grid, shots, grid_results);
+      ShotStats a = GetShotStats(*grid);
+      bool same = grid_results == sparse_results && a.hits == b.hits && a.misses == b.misses
+               && a.duplicates == b.duplicates && a.sunk == b.sunk;
+      std::cout << std::setw(10) << grid_time * 1e9 / static_cast<double>(num_shots)
+                << std::setw(10) << sparse_time * 1e9 / static_cast<double>(num_shots)
+                << std::setw(13) << cells * static_cast<long long>(sizeof(int))
+                << std::setw(13) << SparseBytes(*sparse)
+                << (same ? "   match" : "   DIFFER") << "\n";
+      DestroyOcean(grid);
+    } else {
+      std::cout << std::setw(10) << "-"
+                << std::setw(10) << sparse_time * 1e9 / static_cast<double>(num_shots)
+                << std::setw(13) << cells * static_cast<long long>(sizeof(int))
+                << std::setw(13) << SparseBytes(*sparse) << "   (grid not built)\n";
+    }
+    DestroyOcean(sparse);
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "        ocean  shot at     shots   grid ns sparse ns   grid bytes sparse bytes\n";
+  for (int size : {100, 1'000, 4'000}) {
+    for (double density : {0.001, 0.01, 0.1}) {
+      run(size, density, true);
+    }
+  }
+  run(100'000, 0.00001, false);
+  run(100'000, 0.0001, false);
+}
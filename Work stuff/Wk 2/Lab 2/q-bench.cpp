@@ -0,0 +1,215 @@
+/*!*************************************************************************
+****
+\file q-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Benchmark of the tsunami file parser and summary statistics.
+ The function include:
+- main()
+Writes a catalog of generated events with the same messy spacing as the
+sample files, parses it with the original getline/stringstream loop and
+with TsunamiTable and by mapping its binary cache, checks that all three
+agree and prints the time of each;
+then times the summary (maximum, average and rows above average) over the
+Tsunami array against the column kernels
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>   // std::remove
+#include "q.hpp"
+#include "q-columns.hpp"
+#include "q-cache.hpp"
+
+namespace {
+
+  char const *TEMP_FILE {"q-bench-tsunamis.txt"};
+  char const *TEMP_CACHE {"q-bench-tsunamis.bin"};
+  char const *PLACES[] {"Nicaragua", "Flores Island, Indonesia", "Okushiri, Japan",
+                        "East Java, Indonesia", "Papua New Guinea", "Sumatra, Indonesia",
+                        "Ryuku Islands, Japan", "Constitucion, Chile", "Samoa"};
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  unsigned next_rand(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+  }
+
+  std::string pad(unsigned& seed) {
+    return std::string(1 + next_rand(seed) % 5, ' ');
+  }
+
+  void write_catalog(std::size_t count) {
+    std::ofstream output(TEMP_FILE, std::ios_base::out);
+    unsigned seed = 3;
+    for (std::size_t i = 0; i < count; i++) {
+      output << pad(seed) << 1 + next_rand(seed) % 12 << pad(seed) << 1 + next_rand(seed) % 28
+             << pad(seed) << 1500 + next_rand(seed) % 520 << pad(seed) << next_rand(seed) % 250000
+             << pad(seed) << next_rand(seed) % 60 << '.' << next_rand(seed) % 100
+             << pad(seed) << PLACES[next_rand(seed) % 9] << pad(seed) << "\n";
+    }
+  }
+
+  // the original parser, with its 100-entry stack array replaced by a
+  // vector so it can run past 100 lines
+  std::vector<hlp2::Tsunami> legacy_read(std::string const& file_name) {
+    std::ifstream testfile(file_name, std::ios_base::in);
+    std::string testline;
+    std::size_t line_count = 0;
+    while (std::getline(testfile, testline)) {
+      line_count++;
+    }
+    testfile.close();
+    std::ifstream input(file_name, std::ios_base::in);
+    std::vector<hlp2::Tsunami> arr1;
+    std::string line;
+    while (std::getline(input, line)) {
+      std::stringstream ss(line);
+      std::string remains;
+      hlp2::Tsunami t;
+      ss >> t.month >> t.day >> t.year >> t.fatals >> t.max_wh;
+      std::getline(ss, remains);
+      std::size_t pos_1 = remains.find_first_of("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+      std::size_t pos_2 = remains.find_last_of("abcdefghijklmnopqrstuvwxyz");
+      t.location = remains.substr(pos_1, ((pos_2 + 1) - pos_1));
+      arr1.push_back(t);
+    }
+    std::vector<hlp2::Tsunami> result(arr1.begin(), arr1.begin() + static_cast<std::ptrdiff_t>(line_count));
+    return result;
+  }
+
+  void run(std::size_t count) {
+    write_catalog(count);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<hlp2::Tsunami> legacy = legacy_read(TEMP_FILE);
+    double legacy_time = seconds_since(start);
+
+    start = std::chrono::steady_clock::now();
+    hlp2::TsunamiTable data;
+    data.read(TEMP_FILE);
+    double parse_time = seconds_since(start);
+
+    bool same = legacy.size() == data.size();
+    for (std::size_t i = 0; same && i < legacy.size(); i++) {
+      same = legacy[i].month == data.month()[i] && legacy[i].day == data.day()[i]
+          && legacy[i].year == data.year()[i] && legacy[i].fatals == data.fatals()[i]
+          && legacy[i].max_wh == data.max_wh()[i] && legacy[i].location == data.location(i);
+    }
+
+    hlp2::write_tsunami_cache(data, TEMP_FILE, TEMP_CACHE);
+    start = std::chrono::steady_clock::now();
+    hlp2::TsunamiCache cache;
+    bool hit = cache.open(TEMP_CACHE, TEMP_FILE);
+    double cache_time = seconds_since(start);
+
+    same = same && hit && cache.size() == data.size();
+    for (std::size_t i = 0; same && i < data.size(); i++) {
+      same = cache.month()[i] == data.month()[i] && cache.day()[i] == data.day()[i]
+          && cache.year()[i] == data.year()[i] && cache.fatals()[i] == data.fatals()[i]
+          && cache.max_wh()[i] == data.max_wh()[i] && cache.location(i) == data.location(i);
+    }
+    same = same && cache.info().max_wh_sum == hlp2::column_sum(data.max_wh().data(), data.size());
+    cache.close();
+    std::remove(TEMP_FILE);
+    std::remove(TEMP_CACHE);
+
+    std::cout << std::setw(9) << count << std::setw(12) << legacy_time * 1e3
+              << std::setw(12) << parse_time * 1e3 << std::setw(9) << legacy_time / parse_time << "x"
+              << std::setw(12) << cache_time * 1e3
+              << (same ? "   match" : "   DIFFER") << "\n";
+  }
+
+  // maximum, average and rows above average, the way print_tsunami_data
+  // used to walk the Tsunami array
+  std::size_t legacy_summary(std::vector<hlp2::Tsunami> const& arr, double& max, double& avg,
+                             std::vector<std::size_t>& rows) {
+    max = 0;
+    double total = 0.0;
+    for (hlp2::Tsunami const& t : arr) {
+      if (max < t.max_wh) {
+        max = t.max_wh;
+      }
+      total += t.max_wh;
+    }
+    avg = total / static_cast<double>(arr.size());
+    std::size_t n = 0;
+    for (std::size_t i = 0; i < arr.size(); i++) {
+      if (arr[i].max_wh > avg) {
+        rows[n++] = i;
+      }
+    }
+    return n;
+  }
+
+  void run_summary(std::size_t count, int repeats) {
+    std::vector<hlp2::Tsunami> arr(count);
+    hlp2::TsunamiTable table;
+    unsigned seed = 5;
+    for (std::size_t i = 0; i < count; i++) {
+      arr[i].month = 1 + static_cast<int>(next_rand(seed) % 12);
+      arr[i].day = 1 + static_cast<int>(next_rand(seed) % 28);
+      arr[i].year = 1500 + static_cast<int>(next_rand(seed) % 520);
+      arr[i].fatals = static_cast<int>(next_rand(seed) % 250000);
+      arr[i].max_wh = static_cast<double>(next_rand(seed) % 6000) / 100.0;
+      arr[i].location = PLACES[next_rand(seed) % 9];
+      table.append(arr[i]);
+    }
+    std::vector<std::size_t> rows(count);
+    std::vector<std::size_t> column_rows(count);
+
+    double max = 0, avg = 0;
+    std::size_t n = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+      n = legacy_summary(arr, max, avg, rows);
+    }
+    double legacy_time = seconds_since(start) / repeats;
+
+    double col_max = 0, col_avg = 0;
+    std::size_t col_n = 0;
+    double const *max_wh = table.max_wh().data();
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+      col_max = std::max(0.0, hlp2::column_max(max_wh, count));
+      col_avg = hlp2::column_mean(max_wh, count);
+      col_n = hlp2::column_select_greater(max_wh, count, col_avg, column_rows.data());
+    }
+    double column_time = seconds_since(start) / repeats;
+
+    bool same = max == col_max && avg == col_avg && n == col_n
+             && std::equal(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(n), column_rows.begin());
+    std::cout << std::setw(9) << count << std::setw(12) << legacy_time * 1e3
+              << std::setw(12) << column_time * 1e3 << std::setw(9) << legacy_time / column_time << "x"
+              << (same ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << "  records   legacy ms  one-pass ms  speedup  mmap cache ms\n";
+  run(1'000);
+  run(100'000);
+  run(1'000'000);
+
+  std::cout << "\nsummary kernels: " << hlp2::column_kernel_name() << "\n";
+  std::cout << "  records    array ms   column ms  speedup\n";
+  run_summary(10'000, 200);
+  run_summary(1'000'000, 5);
+  run_summary(10'000'000, 1);
+}
@@ -0,0 +1,291 @@
+/*!*************************************************************************
+****
+\file q-cache.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Binary cache of a tsunami catalog that is memory-mapped instead of parsed.
+Uses the POSIX stat/mmap calls.
+ The function include:
+- write_tsunami_cache()
+Writes a TsunamiTable in the cache format, stamped with its source file
+- TsunamiCache
+Read-only mapping of a cache file; open_or_build() falls back to the text
+parser and rewrites the cache when it is missing or stale
+- print_tsunami_data()
+The summary report straight from the mapped columns and header aggregates
+****************************************************************************
+***/
+#include "q-cache.hpp"
+#include "q-columns.hpp"
+#include <algorithm>
+#include <cmath>    // NAN
+#include <cstdio>   // std::rename, std::remove
+#include <cstdlib>  // mkstemp
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    static_assert(sizeof(int) == sizeof(std::int32_t), "TsunamiTable int columns are stored as int32");
+
+    char const CACHE_MAGIC[8] {'T', 'S', 'U', 'N', 'A', 'M', 'I', '\0'};
+
+    struct SourceStamp {
+        bool found;
+        std::uint64_t size;
+        std::int64_t mtime_ns;
+    };
+
+    SourceStamp stamp_of(std::string const& file_name){
+        struct stat st;
+        if(stat(file_name.c_str(), &st) != 0){
+            return SourceStamp {false, 0, 0};
+        }
+        return SourceStamp {true, static_cast<std::uint64_t>(st.st_size),
+                            static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1'000'000'000 + st.st_mtim.tv_nsec};
+    }
+
+    std::uint64_t align8(std::uint64_t at){
+        return (at + 7) & ~std::uint64_t {7};
+    }
+
+    template <typename T>
+    void put_column(std::vector<std::uint64_t>& image, std::uint64_t at, T const *values, std::size_t count){
+        std::memcpy(reinterpret_cast<char*>(image.data()) + at, values, count * sizeof(T));
+    }
+
+    // the whole cache file in memory, 8-byte aligned
+    std::vector<std::uint64_t> build_image(hlp2::TsunamiTable const& table, SourceStamp stamp){
+        std::size_t count = table.size();
+        std::uint64_t string_bytes = 0;
+        for(std::size_t i = 0; i < count; i++){
+            string_bytes += table.location(i).size();
+        }
+
+        hlp2::TsunamiCacheHeader h {};
+        std::memcpy(h.magic, CACHE_MAGIC, sizeof h.magic);
+        h.version = hlp2::TSUNAMI_CACHE_VERSION;
+        h.header_size = sizeof h;
+        h.count = count;
+        h.source_size = stamp.size;
+        h.source_mtime_ns = stamp.mtime_ns;
+        h.month_at = align8(sizeof h);
+        h.day_at = align8(h.month_at + count * sizeof(std::int32_t));
+        h.year_at = align8(h.day_at + count * sizeof(std::int32_t));
+        h.fatals_at = align8(h.year_at + count * sizeof(std::int32_t));
+        h.max_wh_at = align8(h.fatals_at + count * sizeof(std::int32_t));
+        h.location_at = align8(h.max_wh_at + count * sizeof(double));
+        h.length_at = align8(h.location_at + count * sizeof(std::uint64_t));
+        h.strings_at = align8(h.length_at + count * sizeof(std::uint32_t));
+        h.string_bytes = string_bytes;
+        h.file_size = align8(h.strings_at + string_bytes);
+
+        double const *max_wh = table.max_wh().data();
+        int const *fatals = table.fatals().data();
+        h.max_wh_sum = hlp2::column_sum(max_wh, count);
+        h.fatals_sum = hlp2::column_sum(fatals, count);
+        if(count){
+            h.max_wh_min = *std::min_element(max_wh, max_wh + count);
+            h.max_wh_max = hlp2::column_max(max_wh, count);
+            h.fatals_min = *std::min_element(fatals, fatals + count);
+            h.fatals_max = hlp2::column_max(fatals, count);
+        }
+
+        std::vector<std::uint64_t> image(static_cast<std::size_t>(h.file_size / 8), 0);
+        std::memcpy(image.data(), &h, sizeof h);
+        put_column(image, h.month_at, table.month().data(), count);
+        put_column(image, h.day_at, table.day().data(), count);
+        put_column(image, h.year_at, table.year().data(), count);
+        put_column(image, h.fatals_at, fatals, count);
+        put_column(image, h.max_wh_at, max_wh, count);
+
+        char *bytes = reinterpret_cast<char*>(image.data());
+        std::uint64_t offset = 0;
+        for(std::size_t i = 0; i < count; i++){
+            std::string_view loc = table.location(i);
+            std::uint32_t length = static_cast<std::uint32_t>(loc.size());
+            std::memcpy(bytes + h.location_at + i * sizeof offset, &offset, sizeof offset);
+            std::memcpy(bytes + h.length_at + i * sizeof length, &length, sizeof length);
+            std::memcpy(bytes + h.strings_at + offset, loc.data(), loc.size());
+            offset += loc.size();
+        }
+        return image;
+    }
+
+    // written to a temporary file of its own next to the cache and renamed
+    // over it, so a reader never maps a half-written file and two builders
+    // never write the same temporary
+    bool write_image(std::vector<std::uint64_t> const& image, std::string const& cache_file){
+        std::string temp = cache_file + ".XXXXXX";
+        int fd = mkstemp(&temp[0]);
+        if(fd < 0){
+            return false;
+        }
+        fchmod(fd, 0644);   // mkstemp creates it 0600
+        char const *data = reinterpret_cast<char const*>(image.data());
+        std::size_t left = image.size() * sizeof(std::uint64_t);
+        while(left > 0){
+            ssize_t wrote = write(fd, data, left);
+            if(wrote <= 0){
+                break;
+            }
+            data += wrote;
+            left -= static_cast<std::size_t>(wrote);
+        }
+        if(::close(fd) != 0 || left > 0){
+            std::remove(temp.c_str());
+            return false;
+        }
+        if(std::rename(temp.c_str(), cache_file.c_str()) != 0){
+            std::remove(temp.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool section_fits(std::uint64_t at, std::uint64_t bytes, std::uint64_t file_size){
+        return at % 8 == 0 && at <= file_size && bytes <= file_size - at;
+    }
+
+}
+
+namespace hlp2 {
+
+bool write_tsunami_cache(TsunamiTable const& table, std::string const& source_file,
+                         std::string const& cache_file){
+    return write_image(build_image(table, stamp_of(source_file)), cache_file);
+}
+
+TsunamiCache::~TsunamiCache(){
+    close();
+}
+
+void TsunamiCache::close(){
+    if(mapped){
+        munmap(const_cast<char*>(base), mapped);
+    }
+    image.clear();
+    image.shrink_to_fit();
+    base = nullptr;
+    mapped = 0;
+    header = nullptr;
+}
+
+// checks the header and section bounds of a cache image; the records
+// themselves are used as they are
+bool TsunamiCache::adopt(char const *data, std::size_t size){
+    if(size < sizeof(TsunamiCacheHeader)){
+        return false;
+    }
+    TsunamiCacheHeader const *h = reinterpret_cast<TsunamiCacheHeader const*>(data);
+    std::uint64_t n = h->count;
+    bool ok = std::memcmp(h->magic, CACHE_MAGIC, sizeof h->magic) == 0
+           && h->version == TSUNAMI_CACHE_VERSION && h->header_size == sizeof *h
+           && h->file_size == size && n <= size
+           && section_fits(h->month_at, n * sizeof(std::int32_t), size)
+           && section_fits(h->day_at, n * sizeof(std::int32_t), size)
+           && section_fits(h->year_at, n * sizeof(std::int32_t), size)
+           && section_fits(h->fatals_at, n * sizeof(std::int32_t), size)
+           && section_fits(h->max_wh_at, n * sizeof(double), size)
+           && section_fits(h->location_at, n * sizeof(std::uint64_t), size)
+           && section_fits(h->length_at, n * sizeof(std::uint32_t), size)
+           && section_fits(h->strings_at, h->string_bytes, size);
+    if(ok){
+        base = data;
+        header = h;
+    }
+    return ok;
+}
+
+bool TsunamiCache::open(std::string const& cache_file, std::string const& source_file){
+    close();
+    int fd = ::open(cache_file.c_str(), O_RDONLY);
+    if(fd < 0){
+        return false;
+    }
+    struct stat st;
+    void *data = MAP_FAILED;
+    if(fstat(fd, &st) == 0 && st.st_size > 0){
+        data = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if(data == MAP_FAILED){
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(st.st_size);
+    if(!adopt(static_cast<char const*>(data), size)){
+        munmap(data, size);
+        return false;
+    }
+    mapped = size;
+
+    // a cache without its source is still served; otherwise the source must
+    // be the same file the cache was built from
+    SourceStamp stamp = stamp_of(source_file);
+    if(stamp.found && (stamp.size != header->source_size || stamp.mtime_ns != header->source_mtime_ns)){
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool TsunamiCache::open_or_build(std::string const& cache_file, std::string const& source_file){
+    if(open(cache_file, source_file)){
+        return true;
+    }
+    TsunamiTable table;
+    if(!table.read(source_file)){
+        return false;
+    }
+    std::vector<std::uint64_t> built = build_image(table, stamp_of(source_file));
+    if(write_image(built, cache_file) && open(cache_file, source_file)){
+        return true;
+    }
+    // the cache could not be written (read-only directory, full disk):
+    // serve the same image from memory
+    image.swap(built);
+    return adopt(reinterpret_cast<char const*>(image.data()), image.size() * sizeof(std::uint64_t));
+}
+
+std::string_view TsunamiCache::location(std::size_t i) const{
+    std::uint64_t offset;
+    std::uint32_t length;
+    std::memcpy(&offset, base + header->location_at + i * sizeof offset, sizeof offset);
+    std::memcpy(&length, base + header->length_at + i * sizeof length, sizeof length);
+    // substr throws rather than reading past the string table of a corrupt file
+    return std::string_view(base + header->strings_at, static_cast<std::size_t>(header->string_bytes))
+           .substr(static_cast<std::size_t>(offset), length);
+}
+
+void print_tsunami_data(TsunamiCache const& cache, std::string const& file_name){
+    // the columns are only defined once a cache is open
+    if(!cache.is_open()){
+        print_tsunami_data(TsunamiTable(), file_name);
+        return;
+    }
+    std::size_t count = cache.size();
+    TsunamiCacheHeader const& h = cache.info();
+    TsunamiReport report {count, cache.month(), cache.day(), cache.year(), cache.fatals(), cache.max_wh(),
+                          count ? h.max_wh_max : 0.0,
+                          count ? h.max_wh_sum / static_cast<double>(count) : NAN,   // as column_mean()
+                          [&cache](std::size_t i){ return cache.location(i); }};
+    print_tsunami_data(report, file_name);
+}
+
+void TsunamiCache::to_table(TsunamiTable& table) const{
+    std::size_t count = size();
+    table.reserve(table.size() + count, static_cast<std::size_t>(header ? header->string_bytes : 0));
+    for(std::size_t i = 0; i < count; i++){
+        table.append(month()[i], day()[i], year()[i], fatals()[i], max_wh()[i], location(i));
+    }
+}
+
+} // end namespace hlp2
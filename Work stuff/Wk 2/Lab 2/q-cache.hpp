@@ -0,0 +1,113 @@
+/*!*************************************************************************
+****
+\file q-cache.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Binary cache of a tsunami catalog that is memory-mapped instead of parsed.
+ The function include:
+- write_tsunami_cache()
+Writes a TsunamiTable in the cache format, stamped with its source file
+- TsunamiCache
+Read-only mapping of a cache file; open_or_build() falls back to the text
+parser and rewrites the cache when it is missing or stale
+- print_tsunami_data()
+The summary report straight from the mapped columns and header aggregates
+****************************************************************************
+***/
+#ifndef Q_CACHE_HPP
+#define Q_CACHE_HPP
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "q.hpp"
+
+namespace hlp2 {
+
+// layout of a cache file: this header, then each column as a fixed-width
+// array starting on an 8-byte boundary, then the location bytes
+struct TsunamiCacheHeader {
+    char magic[8];                // "TSUNAMI" and a zero
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t file_size;
+    std::uint64_t count;
+    std::uint64_t source_size;    // size and modification time of the text
+    std::int64_t source_mtime_ns; // file the cache was built from
+    double max_wh_min;
+    double max_wh_max;
+    double max_wh_sum;            // added in row order, like column_sum()
+    std::int64_t fatals_min;
+    std::int64_t fatals_max;
+    std::int64_t fatals_sum;
+    // byte offsets of the sections from the start of the file
+    std::uint64_t month_at;       // int32[count]
+    std::uint64_t day_at;         // int32[count]
+    std::uint64_t year_at;        // int32[count]
+    std::uint64_t fatals_at;      // int32[count]
+    std::uint64_t max_wh_at;      // double[count]
+    std::uint64_t location_at;    // uint64[count] offset into the strings
+    std::uint64_t length_at;      // uint32[count] location length
+    std::uint64_t strings_at;     // char[string_bytes]
+    std::uint64_t string_bytes;
+};
+
+std::uint32_t const TSUNAMI_CACHE_VERSION {1};
+
+bool write_tsunami_cache(TsunamiTable const& table, std::string const& source_file,
+                         std::string const& cache_file);
+
+class TsunamiCache {
+public:
+    TsunamiCache() = default;
+    ~TsunamiCache();
+    TsunamiCache(TsunamiCache const&) = delete;
+    TsunamiCache& operator=(TsunamiCache const&) = delete;
+
+    // maps cache_file; false if it is missing, malformed, from another
+    // version, or older than source_file
+    bool open(std::string const& cache_file, std::string const& source_file);
+    // open(), or else parse source_file, rewrite cache_file and map it
+    bool open_or_build(std::string const& cache_file, std::string const& source_file);
+    void close();
+    bool is_open() const { return header != nullptr; }
+
+    std::size_t size() const { return header ? static_cast<std::size_t>(header->count) : 0; }
+    TsunamiCacheHeader const& info() const { return *header; }
+    std::int32_t const* month() const { return column<std::int32_t>(header->month_at); }
+    std::int32_t const* day() const { return column<std::int32_t>(header->day_at); }
+    std::int32_t const* year() const { return column<std::int32_t>(header->year_at); }
+    std::int32_t const* fatals() const { return column<std::int32_t>(header->fatals_at); }
+    double const* max_wh() const { return column<double>(header->max_wh_at); }
+    std::string_view location(std::size_t i) const;
+
+    // owning copy, for code written against TsunamiTable
+    void to_table(TsunamiTable& table) const;
+
+private:
+    template <typename T>
+    T const* column(std::uint64_t at) const {
+        return reinterpret_cast<T const*>(base + at);
+    }
+
+    bool adopt(char const *data, std::size_t size);
+
+    char const *base = nullptr;
+    std::size_t mapped = 0;                // bytes mapped, 0 when base is image
+    std::vector<std::uint64_t> image;      // in-memory cache if it could not be written
+    TsunamiCacheHeader const *header = nullptr;
+};
+
+// the report of print_tsunami_data(TsunamiTable const&, ...) without
+// copying the records out of the mapping or rescanning max_wh; a cache
+// that is not open prints the empty report
+void print_tsunami_data(TsunamiCache const& cache, std::string const& file_name);
+
+} // end namespace hlp2
+#endif
@@ -0,0 +1,226 @@
+/*!*************************************************************************
+****
+\file q-columns.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Summary kernels over one column of a TsunamiTable. They use AVX2 when the
+compiler targets it, SSE2 otherwise, and plain loops on other machines.
+ The function include:
+- column_max()
+Largest value of a column
+- column_sum()
+Sum of a column
+- column_mean()
+Average of a column
+- column_select_greater()
+Rows whose value is greater than a threshold, in row order
+- column_kernel_name()
+Name of the instruction set the kernels were compiled for
+****************************************************************************
+***/
+#include "q-columns.hpp"
+#include <algorithm>
+#include <cmath>   // NAN
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define Q_COLUMNS_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define Q_COLUMNS_SSE2
+#endif
+
+namespace {
+
+    // appends the rows of the set bits of a comparison mask
+    inline std::size_t emit_rows(unsigned bits, std::size_t base, std::size_t *rows, std::size_t n){
+        while(bits){
+            rows[n++] = base + static_cast<std::size_t>(__builtin_ctz(bits));
+            bits &= bits - 1;
+        }
+        return n;
+    }
+
+#if defined(Q_COLUMNS_SSE2)
+    // SSE2 has no 32-bit max, so blend on a compare
+    inline __m128i max_epi32(__m128i a, __m128i b){
+        __m128i gt = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+    }
+#endif
+
+}
+
+namespace hlp2 {
+
+double column_max(double const *values, std::size_t count){
+    double best = -std::numeric_limits<double>::infinity();
+    std::size_t i = 0;
+#if defined(Q_COLUMNS_AVX2)
+    __m256d acc = _mm256_set1_pd(best);
+    for(; i + 4 <= count; i += 4){
+        acc = _mm256_max_pd(acc, _mm256_loadu_pd(values + i));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    best = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#elif defined(Q_COLUMNS_SSE2)
+    __m128d acc0 = _mm_set1_pd(best);
+    __m128d acc1 = acc0;
+    for(; i + 4 <= count; i += 4){
+        acc0 = _mm_max_pd(acc0, _mm_loadu_pd(values + i));
+        acc1 = _mm_max_pd(acc1, _mm_loadu_pd(values + i + 2));
+    }
+    double lanes[4];
+    _mm_storeu_pd(lanes, acc0);
+    _mm_storeu_pd(lanes + 2, acc1);
+    best = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+#endif
+    for(; i < count; i++){
+        best = std::max(best, values[i]);
+    }
+    return best;
+}
+
+int column_max(int const *values, std::size_t count){
+    int best = std::numeric_limits<int>::min();
+    std::size_t i = 0;
+#if defined(Q_COLUMNS_AVX2)
+    __m256i acc = _mm256_set1_epi32(best);
+    for(; i + 8 <= count; i += 8){
+        acc = _mm256_max_epi32(acc, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i)));
+    }
+    int lanes[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    best = *std::max_element(lanes, lanes + 8);
+#elif defined(Q_COLUMNS_SSE2)
+    __m128i acc = _mm_set1_epi32(best);
+    for(; i + 4 <= count; i += 4){
+        acc = max_epi32(acc, _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i)));
+    }
+    int lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    best = *std::max_element(lanes, lanes + 4);
+#endif
+    for(; i < count; i++){
+        best = std::max(best, values[i]);
+    }
+    return best;
+}
+
+double column_sum(double const *values, std::size_t count){
+    // strictly in row order: a reordered sum rounds differently, and the
+    // average it gives decides which rows the report lists
+    double sum = 0.0;
+    for(std::size_t i = 0; i < count; i++){
+        sum += values[i];
+    }
+    return sum;
+}
+
+long long column_sum(int const *values, std::size_t count){
+    long long sum = 0;
+    std::size_t i = 0;
+#if defined(Q_COLUMNS_AVX2)
+    __m256i acc = _mm256_setzero_si256();
+    for(; i + 4 <= count; i += 4){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(v));
+    }
+    long long lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(Q_COLUMNS_SSE2)
+    __m128i acc = _mm_setzero_si128();
+    for(; i + 4 <= count; i += 4){
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+    }
+    long long lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    sum = lanes[0] + lanes[1];
+#endif
+    for(; i < count; i++){
+        sum += values[i];
+    }
+    return sum;
+}
+
+double column_mean(double const *values, std::size_t count){
+    return count ? column_sum(values, count) / static_cast<double>(count) : NAN;
+}
+
+double column_mean(int const *values, std::size_t count){
+    return count ? static_cast<double>(column_sum(values, count)) / static_cast<double>(count) : NAN;
+}
+
+std::size_t column_select_greater(double const *values, std::size_t count,
+                                  double threshold, std::size_t *rows){
+    std::size_t n = 0;
+    std::size_t i = 0;
+#if defined(Q_COLUMNS_AVX2)
+    __m256d t = _mm256_set1_pd(threshold);
+    for(; i + 4 <= count; i += 4){
+        __m256d gt = _mm256_cmp_pd(_mm256_loadu_pd(values + i), t, _CMP_GT_OQ);
+        n = emit_rows(static_cast<unsigned>(_mm256_movemask_pd(gt)), i, rows, n);
+    }
+#elif defined(Q_COLUMNS_SSE2)
+    __m128d t = _mm_set1_pd(threshold);
+    for(; i + 4 <= count; i += 4){
+        unsigned lo = static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(values + i), t)));
+        unsigned hi = static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(values + i + 2), t)));
+        n = emit_rows(lo | hi << 2, i, rows, n);
+    }
+#endif
+    for(; i < count; i++){
+        if(values[i] > threshold){
+            rows[n++] = i;
+        }
+    }
+    return n;
+}
+
+std::size_t column_select_greater(int const *values, std::size_t count,
+                                  int threshold, std::size_t *rows){
+    std::size_t n = 0;
+    std::size_t i = 0;
+#if defined(Q_COLUMNS_AVX2)
+    __m256i t = _mm256_set1_epi32(threshold);
+    for(; i + 8 <= count; i += 8){
+        __m256i gt = _mm256_cmpgt_epi32(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i)), t);
+        n = emit_rows(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(gt))), i, rows, n);
+    }
+#elif defined(Q_COLUMNS_SSE2)
+    __m128i t = _mm_set1_epi32(threshold);
+    for(; i + 4 <= count; i += 4){
+        __m128i gt = _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i)), t);
+        n = emit_rows(static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(gt))), i, rows, n);
+    }
+#endif
+    for(; i < count; i++){
+        if(values[i] > threshold){
+            rows[n++] = i;
+        }
+    }
+    return n;
+}
+
+char const* column_kernel_name(){
+#if defined(Q_COLUMNS_AVX2)
+    return "avx2";
+#elif defined(Q_COLUMNS_SSE2)
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+} // end namespace hlp2
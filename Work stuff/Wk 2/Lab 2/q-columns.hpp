@@ -0,0 +1,54 @@
+/*!*************************************************************************
+****
+\file q-columns.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Summary kernels over one column of a TsunamiTable.
+ The function include:
+- column_max()
+Largest value of a column
+- column_sum()
+Sum of a column
+- column_mean()
+Average of a column
+- column_select_greater()
+Rows whose value is greater than a threshold, in row order
+- column_kernel_name()
+Name of the instruction set the kernels were compiled for
+****************************************************************************
+***/
+#ifndef Q_COLUMNS_HPP
+#define Q_COLUMNS_HPP
+#include <cstddef>
+
+namespace hlp2 {
+
+// lowest representable value (-infinity for doubles) when count is 0
+double column_max(double const *values, std::size_t count);
+int column_max(int const *values, std::size_t count);
+
+// doubles are added in row order, so the sum rounds exactly as a plain
+// loop would; the int sum is vectorized
+double column_sum(double const *values, std::size_t count);
+long long column_sum(int const *values, std::size_t count);
+
+// NaN when count is 0
+double column_mean(double const *values, std::size_t count);
+double column_mean(int const *values, std::size_t count);
+
+// writes the indices of the selected rows to rows (room for count entries)
+// and returns how many there are
+std::size_t column_select_greater(double const *values, std::size_t count,
+                                  double threshold, std::size_t *rows);
+std::size_t column_select_greater(int const *values, std::size_t count,
+                                  int threshold, std::size_t *rows);
+
+char const* column_kernel_name();
+
+} // end namespace hlp2
+#endif
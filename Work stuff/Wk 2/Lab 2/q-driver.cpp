@@ -3,18 +3,29 @@
 
 #include <iostream>
 #include "q.hpp"
+#include "q-cache.hpp"
 
 /*
 The program requires the name of a text file recording tsunami events.
 Without this text file, it is not possible for the program to do anything
 useful. Therefore, it is important to ensure that there is at least one
 more command-line argument in addition to the program's name.
+An optional third argument names a binary cache of the data file; it is
+mapped instead of parsing the text, and rebuilt when the text has changed.
 */
 int main(int argc, char *argv[]) {
   if (argc < 3) {
-    std::cerr <<  "Usage: ./q.out tsunami-data-file your-summary-output-file;\n";
+    std::cerr <<  "Usage: ./q.out tsunami-data-file your-summary-output-file [cache-file];\n";
     return 0;
   } 
+
+  if (argc > 3) {
+    hlp2::TsunamiCache cache;
+    if (cache.open_or_build(argv[3], argv[1])) {
+      hlp2::print_tsunami_data(cache, argv[2]);
+    }
+    return 0;
+  }
   
   int num_events;
   hlp2::Tsunami *tsun_data = hlp2::read_tsunami_data(argv[1], num_events);
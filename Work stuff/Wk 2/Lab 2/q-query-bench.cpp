@@ -0,0 +1,180 @@
+/*!*************************************************************************
+****
+\file q-query-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Latency benchmark of the TsunamiIndex queries.
+ The function include:
+- main()
+Builds a table of generated events, times the index build, then runs each
+query kind through the index and through a full scan of the table, checks
+that both return the same rows and prints the average latency of each
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include "q.hpp"
+#include "q-query.hpp"
+
+namespace {
+
+  char const *PLACES[] {"Nicaragua", "Flores Island, Indonesia", "Okushiri, Japan",
+                        "East Java, Indonesia", "Papua New Guinea", "Sumatra, Indonesia",
+                        "Ryuku Islands, Japan", "Constitucion, Chile", "Samoa"};
+  char const *PREFIXES[] {"East Java", "Sa", "Okushiri, Japan 12", "Nicaragua 7", "Krakatoa"};
+
+  using Clock = std::chrono::steady_clock;
+
+  double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  }
+
+  unsigned next_rand(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+  }
+
+  std::vector<std::size_t> scan_years(hlp2::TsunamiTable const& t, int lo, int hi) {
+    std::vector<std::size_t> rows;
+    for (std::size_t i = 0; i < t.size(); i++) {
+      if (t.year()[i] >= lo && t.year()[i] <= hi) {
+        rows.push_back(i);
+      }
+    }
+    std::stable_sort(rows.begin(), rows.end(),
+                     [&t](std::size_t a, std::size_t b) { return t.year()[a] < t.year()[b]; });
+    return rows;
+  }
+
+  std::vector<std::size_t> scan_prefix(hlp2::TsunamiTable const& t, std::string_view prefix) {
+    std::vector<std::size_t> rows;
+    for (std::size_t i = 0; i < t.size(); i++) {
+      if (t.location(i).compare(0, prefix.size(), prefix) == 0) {
+        rows.push_back(i);
+      }
+    }
+    std::stable_sort(rows.begin(), rows.end(),
+                     [&t](std::size_t a, std::size_t b) { return t.location(a) < t.location(b); });
+    return rows;
+  }
+
+  template <typename T>
+  std::vector<std::size_t> scan_top(std::vector<T> const& key, std::vector<std::size_t> rows, std::size_t k) {
+    k = std::min(k, rows.size());
+    std::partial_sort(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(k), rows.end(),
+                      [&key](std::size_t a, std::size_t b) { return key[a] != key[b] ? key[a] > key[b] : a < b; });
+    rows.resize(k);
+    return rows;
+  }
+
+  std::vector<std::size_t> all_rows(hlp2::TsunamiTable const& t) {
+    std::vector<std::size_t> rows(t.size());
+    for (std::size_t i = 0; i < rows.size(); i++) {
+      rows[i] = i;
+    }
+    return rows;
+  }
+
+  bool same_rows(hlp2::RowSpan span, std::vector<std::size_t> const& rows) {
+    return span.size() == rows.size() && std::equal(span.begin(), span.end(), rows.begin());
+  }
+
+  void report(char const *name, int queries, double index_time, double scan_time, int scans, bool same) {
+    std::cout << std::left << std::setw(22) << name << std::right
+              << std::setw(12) << index_time * 1e6 / queries
+              << std::setw(12) << scan_time * 1e6 / scans
+              << (same ? "   match" : "   DIFFER") << "\n";
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::size_t const count {1'000'000};
+  int const queries {10'000};
+  int const scans {20};   // the full scans are slow; time a few of them
+
+  hlp2::TsunamiTable table;
+  unsigned seed = 11;
+  for (std::size_t i = 0; i < count; i++) {
+    std::string location = std::string(PLACES[next_rand(seed) % 9]) + " " + std::to_string(next_rand(seed) % 1000);
+    table.append(1 + static_cast<int>(next_rand(seed) % 12), 1 + static_cast<int>(next_rand(seed) % 28),
+                 1500 + static_cast<int>(next_rand(seed) % 520), static_cast<int>(next_rand(seed) % 250000),
+                 static_cast<double>(next_rand(seed) % 6000) / 100.0, location);
+  }
+
+  auto start = Clock::now();
+  hlp2::TsunamiIndex index(table);
+  double build = seconds_since(start);
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << count << " records, index built in " << build * 1e3 << " ms\n\n";
+  std::cout << "query                 index us     scan us\n";
+
+  // years: ranges of up to 20 years
+  std::vector<int> lo(queries), hi(queries);
+  for (int q = 0; q < queries; q++) {
+    lo[q] = 1500 + static_cast<int>(next_rand(seed) % 520);
+    hi[q] = lo[q] + static_cast<int>(next_rand(seed) % 20);
+  }
+  std::size_t total = 0;
+  start = Clock::now();
+  for (int q = 0; q < queries; q++) {
+    total += index.between_years(lo[q], hi[q]).size();
+  }
+  double index_time = seconds_since(start);
+  bool same = true;
+  start = Clock::now();
+  for (int q = 0; q < scans; q++) {
+    same = same_rows(index.between_years(lo[q], hi[q]), scan_years(table, lo[q], hi[q])) && same;
+  }
+  report("year range", queries, index_time, seconds_since(start), scans, same && total > 0);
+
+  start = Clock::now();
+  for (int q = 0; q < queries; q++) {
+    total += index.location_prefix(PREFIXES[q % 5]).size();
+  }
+  index_time = seconds_since(start);
+  same = true;
+  start = Clock::now();
+  for (int q = 0; q < scans; q++) {
+    same = same_rows(index.location_prefix(PREFIXES[q % 5]), scan_prefix(table, PREFIXES[q % 5])) && same;
+  }
+  report("location prefix", queries, index_time, seconds_since(start), scans, same);
+
+  start = Clock::now();
+  for (int q = 0; q < queries; q++) {
+    total += index.top(hlp2::TsunamiKey::fatals, 10 + static_cast<std::size_t>(q % 90)).size();
+  }
+  index_time = seconds_since(start);
+  same = true;
+  start = Clock::now();
+  for (int q = 0; q < scans; q++) {
+    std::size_t k = 10 + static_cast<std::size_t>(q % 90);
+    same = same_rows(index.top(hlp2::TsunamiKey::fatals, k), scan_top(table.fatals(), all_rows(table), k)) && same;
+  }
+  report("top-k fatalities", queries, index_time, seconds_since(start), scans, same);
+
+  start = Clock::now();
+  for (int q = 0; q < queries; q++) {
+    total += index.top_between_years(hlp2::TsunamiKey::max_wh, 10, lo[q], hi[q]).size();
+  }
+  index_time = seconds_since(start);
+  same = true;
+  start = Clock::now();
+  for (int q = 0; q < scans; q++) {
+    std::vector<std::size_t> heap = index.top_between_years(hlp2::TsunamiKey::max_wh, 10, lo[q], hi[q]);
+    std::vector<std::size_t> scan = scan_top(table.max_wh(), scan_years(table, lo[q], hi[q]), 10);
+    same = heap == scan && same;
+  }
+  report("top-k in year range", queries, index_time, seconds_since(start), scans, same);
+  std::cout << "(" << total << " rows returned)\n";
+}
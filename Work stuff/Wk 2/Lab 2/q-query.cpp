@@ -0,0 +1,112 @@
+/*!*************************************************************************
+****
+\file q-query.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Indexed queries over a TsunamiTable.
+ The function include:
+- TsunamiIndex
+Sorts the rows once by year, location, fatalities and wave height; after
+that each query is a binary search or a slice of one of those orders
+****************************************************************************
+***/
+#include "q-query.hpp"
+#include <algorithm>
+#include <numeric>   // std::iota
+
+namespace hlp2 {
+
+TsunamiIndex::TsunamiIndex(TsunamiTable const& table)
+    : table(table), by_year(table.size()){
+    std::iota(by_year.begin(), by_year.end(), std::size_t {0});
+    by_location = by_year;
+    by_fatals = by_year;
+    by_max_wh = by_year;
+
+    // stable sorts over row order, so equal keys stay in row order
+    std::vector<int> const& year = table.year();
+    std::stable_sort(by_year.begin(), by_year.end(),
+                     [&year](std::size_t a, std::size_t b){ return year[a] < year[b]; });
+    std::stable_sort(by_location.begin(), by_location.end(),
+                     [&table](std::size_t a, std::size_t b){ return table.location(a) < table.location(b); });
+    std::stable_sort(by_fatals.begin(), by_fatals.end(),
+                     [this](std::size_t a, std::size_t b){ return ranks_before(TsunamiKey::fatals, a, b); });
+    std::stable_sort(by_max_wh.begin(), by_max_wh.end(),
+                     [this](std::size_t a, std::size_t b){ return ranks_before(TsunamiKey::max_wh, a, b); });
+}
+
+// larger key first; equal keys by row, so every order is total
+bool TsunamiIndex::ranks_before(TsunamiKey key, std::size_t a, std::size_t b) const{
+    if(key == TsunamiKey::fatals){
+        int fa = table.fatals()[a];
+        int fb = table.fatals()[b];
+        return fa != fb ? fa > fb : a < b;
+    }
+    double wa = table.max_wh()[a];
+    double wb = table.max_wh()[b];
+    return wa != wb ? wa > wb : a < b;
+}
+
+RowSpan TsunamiIndex::span(std::vector<std::size_t> const& order, std::size_t lo, std::size_t hi) const{
+    return RowSpan {order.data() + lo, order.data() + hi};
+}
+
+RowSpan TsunamiIndex::between_years(int first_year, int last_year) const{
+    if(first_year > last_year){
+        return span(by_year, 0, 0);
+    }
+    std::vector<int> const& year = table.year();
+    auto lo = std::partition_point(by_year.begin(), by_year.end(),
+                                   [&](std::size_t row){ return year[row] < first_year; });
+    auto hi = std::partition_point(lo, by_year.end(),
+                                   [&](std::size_t row){ return year[row] <= last_year; });
+    return span(by_year, static_cast<std::size_t>(lo - by_year.begin()),
+                static_cast<std::size_t>(hi - by_year.begin()));
+}
+
+RowSpan TsunamiIndex::location_prefix(std::string_view prefix) const{
+    // every location with the prefix sorts at or after the prefix itself,
+    // and they are contiguous from there
+    auto lo = std::partition_point(by_location.begin(), by_location.end(),
+                                   [&](std::size_t row){ return table.location(row) < prefix; });
+    auto hi = std::partition_point(lo, by_location.end(),
+                                   [&](std::size_t row){ return table.location(row).compare(0, prefix.size(), prefix) == 0; });
+    return span(by_location, static_cast<std::size_t>(lo - by_location.begin()),
+                static_cast<std::size_t>(hi - by_location.begin()));
+}
+
+RowSpan TsunamiIndex::top(TsunamiKey key, std::size_t k) const{
+    std::vector<std::size_t> const& order = key == TsunamiKey::fatals ? by_fatals : by_max_wh;
+    return span(order, 0, std::min(k, order.size()));
+}
+
+std::vector<std::size_t> TsunamiIndex::top_between_years(TsunamiKey key, std::size_t k,
+                                                         int first_year, int last_year) const{
+    // min-heap of the best k so far: its front is the weakest kept row
+    auto weaker = [this, key](std::size_t a, std::size_t b){ return ranks_before(key, a, b); };
+    std::vector<std::size_t> heap;
+    if(k == 0){
+        return heap;
+    }
+    heap.reserve(k);
+    for(std::size_t row : between_years(first_year, last_year)){
+        if(heap.size() < k){
+            heap.push_back(row);
+            std::push_heap(heap.begin(), heap.end(), weaker);
+        }
+        else if(ranks_before(key, row, heap.front())){
+            std::pop_heap(heap.begin(), heap.end(), weaker);
+            heap.back() = row;
+            std::push_heap(heap.begin(), heap.end(), weaker);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), weaker);
+    return heap;
+}
+
+} // end namespace hlp2
@@ -0,0 +1,67 @@
+/*!*************************************************************************
+****
+\file q-query.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 2: Tsunami data with structures and dynamic memory
+\date 17-10-2026
+\brief
+Indexed queries over a TsunamiTable.
+ The function include:
+- TsunamiIndex
+Sorts the rows once by year, location, fatalities and wave height; after
+that each query is a binary search or a slice of one of those orders
+****************************************************************************
+***/
+#ifndef Q_QUERY_HPP
+#define Q_QUERY_HPP
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "q.hpp"
+
+namespace hlp2 {
+
+// contiguous run of row numbers inside an index; valid while the index lives
+struct RowSpan {
+    std::size_t const *first;
+    std::size_t const *last;
+
+    std::size_t const* begin() const { return first; }
+    std::size_t const* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+    bool empty() const { return first == last; }
+};
+
+enum class TsunamiKey { fatals, max_wh };
+
+class TsunamiIndex {
+public:
+    // the table must outlive the index and not change while it is used
+    explicit TsunamiIndex(TsunamiTable const& table);
+
+    // rows with first_year <= year <= last_year, by year then row
+    RowSpan between_years(int first_year, int last_year) const;
+    // rows whose location starts with prefix, by location then row
+    RowSpan location_prefix(std::string_view prefix) const;
+    // the k rows with the largest key, largest first (ties by row)
+    RowSpan top(TsunamiKey key, std::size_t k) const;
+    // top() restricted to a year range, kept in a k-entry heap
+    std::vector<std::size_t> top_between_years(TsunamiKey key, std::size_t k,
+                                               int first_year, int last_year) const;
+
+private:
+    bool ranks_before(TsunamiKey key, std::size_t a, std::size_t b) const;
+    RowSpan span(std::vector<std::size_t> const& order, std::size_t lo, std::size_t hi) const;
+
+    TsunamiTable const& table;
+    std::vector<std::size_t> by_year;
+    std::vector<std::size_t> by_location;
+    std::vector<std::size_t> by_fatals;
+    std::vector<std::size_t> by_max_wh;
+};
+
+} // end namespace hlp2
+#endif
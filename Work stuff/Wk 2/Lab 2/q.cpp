@@ -7,100 +7,184 @@
 #include <iomanip>
 // other C++ [not C] standard library headers
 #include "q.hpp"
+#include "q-columns.hpp"
 #include <iostream>
+#include <algorithm> // std::max
+#include <charconv> // std::from_chars
+#include <cstring>  // std::memchr
 
+namespace {
+
+    bool is_blank(char ch){
+        return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\v' || ch == '\f';
+    }
+
+    // skips blanks and reads one number like operator>> would, without
+    // building a stream; p moves past the number on success
+    template <typename T>
+    bool parse_number(char const *&p, char const *eol, T& value){
+        while(p < eol && is_blank(*p)){
+            p++;
+        }
+        if(p < eol && *p == '+'){
+            p++;
+        }
+        std::from_chars_result res = std::from_chars(p, eol, value);
+        if(res.ec != std::errc()){
+            return false;
+        }
+        p = res.ptr;
+        return true;
+    }
+
+}
 
 namespace hlp2 {
 
-  
+    bool TsunamiTable::read(std::string const& file_name){
+        std::ifstream input(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+        if(!input.is_open()){
+            return false;
+        }
+        std::streamoff length = input.tellg();
+        std::string text(length > 0 ? static_cast<std::size_t>(length) : 0, '\0');
+        input.seekg(0);
+        input.read(&text[0], static_cast<std::streamsize>(text.size()));
+        text.resize(static_cast<std::size_t>(input.gcount()));
+        parse(text.data(), text.data() + text.size());
+        return true;
+    }
 
-    Tsunami* read_tsunami_data(std::string const& file_name, int& max_cnt){
-        
-        int line_count = 0;
-        std::ifstream testfile(file_name, std::ios_base::in);
-        
-        std::string testline;
-        while(std::getline(testfile, testline)){
-            //std::cout<<"line is: "<<testline<<std::endl;
-            line_count++;
+    // appends the events of a text buffer; a line needs month day year
+    // fatals max_wh followed by the location, anything else is skipped
+    void TsunamiTable::parse(char const *first, char const *last){
+        // a record line is about 40 bytes; reserving from that avoids most
+        // regrowth, and the vectors still double if the guess is short
+        std::size_t guess = static_cast<std::size_t>(last - first) / 32;
+        reserve(size() + guess, locations.size() + guess * 16);
+
+        char const *line = first;
+        while(line < last){
+            char const *eol = static_cast<char const*>(std::memchr(line, '\n', static_cast<std::size_t>(last - line)));
+            eol = eol ? eol : last;
+
+            int month, day, year, fatals;
+            double max_wh;
+            char const *p = line;
+            bool ok = parse_number(p, eol, month) && parse_number(p, eol, day)
+                   && parse_number(p, eol, year) && parse_number(p, eol, fatals)
+                   && parse_number(p, eol, max_wh);
+            if(ok){
+                // the location runs from its first capital to its last
+                // lower-case letter, which drops padding and stray marks
+                char const *loc_first = p;
+                while(loc_first < eol && !(*loc_first >= 'A' && *loc_first <= 'Z')){
+                    loc_first++;
+                }
+                char const *loc_last = eol;
+                while(loc_last > loc_first && !(loc_last[-1] >= 'a' && loc_last[-1] <= 'z')){
+                    loc_last--;
+                }
+                append(month, day, year, fatals, max_wh,
+                       std::string_view(loc_first, static_cast<std::size_t>(loc_last - loc_first)));
+            }
+            line = (eol < last) ? eol + 1 : last;
         }
-        //std::cout<<"line count is "<<line_count<<std::endl;
-        
-        //std::cout<<"--------------------------------------------------"<<std::endl;
-        testfile.close();
-        std::ifstream input(file_name, std::ios_base::in);
-        //std::ofstream outputtest("testFile.txt", std::ios_base::out);
-        std::string line;
-        Tsunami arr1[100];
-        int index = 0;
-        //int zx = 1;
-        //for every line
-        while(std::getline(input, line)){
-            //std::cout<<"line is: "<<line<<std::endl;
-            std::stringstream ss(line);
-            //int cnt = 0;
-            std::string remains;
-            Tsunami* ptr = &arr1[index++];
-            ss >> ptr->month >> ptr->day >> ptr->year >> ptr->fatals >> ptr->max_wh;
-            //for the remaining string in the line
-            std::getline(ss, remains);
-            //std::cout<<"remains is "<<remains<<std::endl;
-            std::string extract;
-            size_t pos_1 = remains.find_first_of("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
-            size_t pos_2 = remains.find_last_of("abcdefghijklmnopqrstuvwxyz");
-           /* if(zx){
-                pos_2-=1;
-                zx = 0;
-            }*/
-            //std::cout<<"1:"<<remains[pos_1]<<" 2:"<< remains[pos_2]<<std::endl;
-            extract = remains.substr(pos_1, ((pos_2+1)-pos_1));
-            //outputtest<<extract<<std::endl;
-            ptr->location = extract;
-            //outputtest<<extract<<std::endl;
-
-            //need to account for whitespace
-        };
-        
-        //input>>sample.month>>sample.day>>sample.year>>sample.max_wh>>sample.fatals;
-       
-        Tsunami* returnPtr = new Tsunami [line_count];
-
-        int someCnt = 0;
-        for(int i = 0;i<line_count;i++){
-            *(returnPtr+someCnt) = arr1[someCnt];
-            someCnt++;
-            //change loop type
+    }
+
+    void TsunamiTable::reserve(std::size_t count, std::size_t location_bytes){
+        month_col.reserve(count);
+        day_col.reserve(count);
+        year_col.reserve(count);
+        fatals_col.reserve(count);
+        max_wh_col.reserve(count);
+        location_offset.reserve(count);
+        location_length.reserve(count);
+        locations.reserve(location_bytes);
+    }
+
+    void TsunamiTable::append(int month, int day, int year, int fatals, double max_wh,
+                              std::string_view location){
+        month_col.push_back(month);
+        day_col.push_back(day);
+        year_col.push_back(year);
+        fatals_col.push_back(fatals);
+        max_wh_col.push_back(max_wh);
+        location_offset.push_back(locations.size());
+        location_length.push_back(location.size());
+        locations.append(location);
+    }
+
+    void TsunamiTable::append(Tsunami const& event){
+        append(event.month, event.day, event.year, event.fatals, event.max_wh, event.location);
+    }
+
+    std::string_view TsunamiTable::location(std::size_t i) const{
+        return std::string_view(locations).substr(location_offset[i], location_length[i]);
+    }
+
+    Tsunami* TsunamiTable::to_array() const{
+        Tsunami* arr = new Tsunami [size()];
+        for(std::size_t i = 0; i < size(); i++){
+            arr[i].month = month_col[i];
+            arr[i].day = day_col[i];
+            arr[i].year = year_col[i];
+            arr[i].fatals = fatals_col[i];
+            arr[i].max_wh = max_wh_col[i];
+            arr[i].location.assign(location(i));
+        }
+        return arr;
+    }
+
+    Tsunami* read_tsunami_data(std::string const& file_name, int& max_cnt){
+        TsunamiTable data;
+        if(!data.read(file_name)){
+            max_cnt = 0;
+            return nullptr;
         }
-        max_cnt = line_count;
-        input.close();
-        return returnPtr;
-        //std::array<Tsunami, sizeof(arr1)/sizeof(arr1[0])> returnPtr = arr1;
-       
+        max_cnt = static_cast<int>(data.size());
+        return data.to_array();
     }
 
 
     void print_tsunami_data(Tsunami const *arr,int size, std::string const& file_name){
+        TsunamiTable table;
+        table.reserve(size > 0 ? static_cast<std::size_t>(size) : 0, 0);
+        for(int i = 0; i<size; i++){
+            table.append(arr[i]);
+        }
+        print_tsunami_data(table, file_name);
+    }
+
+    void print_tsunami_data(TsunamiTable const& table, std::string const& file_name){
+        std::size_t size = table.size();
+        double const *max_wh = table.max_wh().data();
+        TsunamiReport report {size, table.month().data(), table.day().data(), table.year().data(),
+                              table.fatals().data(), max_wh, column_max(max_wh, size), column_mean(max_wh, size),
+                              [&table](std::size_t i){ return table.location(i); }};
+        print_tsunami_data(report, file_name);
+    }
+
+    void print_tsunami_data(TsunamiReport const& report, std::string const& file_name){
         std::ofstream output(file_name, std::ios_base::out);
         output<<"List of tsunamis:"<<std::endl;
         output<<"-----------------"<<std::endl;
-        double true_max = 0;
-        double total_wh = 0.0;
-        double avg_wh = 0.0;
+        std::size_t size = report.size;
+        double const *max_wh = report.max_wh;
 
-        for(int i = 0; i<size; i++){
-            output  << std::setfill('0')<<std::setw(2)<<arr[i].month;
-            output  << " "<<std::setfill('0') <<std::setw(2)<<arr[i].day;
-            output  << " " <<arr[i].year << std::setfill(' ');
-            output  << std::setw(7)<< arr[i].fatals;//<<"      ";
-            output  << std::setw(11)<< std::setprecision(2)<<std::fixed<< arr[i].max_wh<< "     ";
-            output  <<arr[i].location <<std::endl;
-            if(true_max<arr[i].max_wh){
-                true_max = arr[i].max_wh;
-            }
-            total_wh+=arr[i].max_wh;
+        for(std::size_t i = 0; i<size; i++){
+            output  << std::setfill('0')<<std::setw(2)<<report.month[i];
+            output  << " "<<std::setfill('0') <<std::setw(2)<<report.day[i];
+            output  << " " <<report.year[i] << std::setfill(' ');
+            output  << std::setw(7)<< report.fatals[i];
+            output  << std::setw(11)<< std::setprecision(2)<<std::fixed<< max_wh[i]<< "     ";
+            output  <<report.location(i) <<'\n';
         }
         output<<"\n";
-        avg_wh = total_wh/((double)size);
+        // the maximum starts from 0 as it always has, so an empty file
+        // reports 0 rather than -inf
+        double true_max = std::max(0.0, report.max_wh_max);
+        double avg_wh = report.max_wh_mean;
         output<<"Summary information for tsunamis"<<std::endl;
         output<<"--------------------------------"<<std::endl;
         output<<"\n";
@@ -109,12 +193,10 @@ namespace hlp2 {
         output<<"Average wave height (in meters): "<<std::setw(5)<<avg_wh<<std::endl;
         output<<"\n";
         output<<"Tsunamis with greater than average height "<<avg_wh<<":"<<std::endl;
-        for(int i = 0; i<size; i++){
-            if(arr[i].max_wh>avg_wh){
-                output<<arr[i].max_wh<<"     "<<arr[i].location<<std::endl;
-            }
+        std::vector<std::size_t> rows(size);
+        std::size_t count = column_select_greater(max_wh, size, avg_wh, rows.data());
+        for(std::size_t k = 0; k<count; k++){
+            output<<max_wh[rows[k]]<<"     "<<report.location(rows[k])<<'\n';
         }
-
-
-    } 
+    }
 }// end namespace hlp2
\ No newline at end of file
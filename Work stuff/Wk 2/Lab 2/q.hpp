@@ -5,6 +5,9 @@
 #include <fstream> // to use C++ file I/O interface
 #include "q.hpp"
 // other C++ [not C] standard library headers
+#include <functional>
+#include <string_view>
+#include <vector>
 
 
 
@@ -22,8 +25,59 @@ struct Tsunami {
 
 };
 
+// every event of a file stored column by column, so the summary kernels in
+// q-columns.hpp run over contiguous arrays; the locations share one string
+class TsunamiTable {
+public:
+        bool read(std::string const& file_name);
+        void parse(char const *first, char const *last);
+
+        void reserve(std::size_t count, std::size_t location_bytes);
+        void append(int month, int day, int year, int fatals, double max_wh,
+                    std::string_view location);
+        void append(Tsunami const& event);
+
+        std::size_t size() const { return max_wh_col.size(); }
+        std::vector<int> const& month() const { return month_col; }
+        std::vector<int> const& day() const { return day_col; }
+        std::vector<int> const& year() const { return year_col; }
+        std::vector<int> const& fatals() const { return fatals_col; }
+        std::vector<double> const& max_wh() const { return max_wh_col; }
+        std::string_view location(std::size_t i) const;
+
+        // new[] copy in the layout used by print_tsunami_data
+        Tsunami* to_array() const;
+
+private:
+        std::vector<int> month_col;
+        std::vector<int> day_col;
+        std::vector<int> year_col;
+        std::vector<int> fatals_col;
+        std::vector<double> max_wh_col;
+        std::vector<std::size_t> location_offset;
+        std::vector<std::size_t> location_length;
+        std::string locations; // all locations back to back
+};
+
+// the columns of a catalog wherever they are stored (TsunamiTable,
+// TsunamiCache) and the two aggregates the summary needs, so a source that
+// already knows them does not rescan its columns
+struct TsunamiReport {
+        std::size_t size;
+        int const *month;
+        int const *day;
+        int const *year;
+        int const *fatals;
+        double const *max_wh;
+        double max_wh_max;   // of the rows; the summary never reports below 0
+        double max_wh_mean;
+        std::function<std::string_view(std::size_t)> location;
+};
+
 Tsunami* read_tsunami_data(std::string const& file_name, int& max_cnt);
 void print_tsunami_data(Tsunami const *arr,int size, std::string const& file_name);
+void print_tsunami_data(TsunamiTable const& table, std::string const& file_name);
+void print_tsunami_data(TsunamiReport const& report, std::string const& file_name);
 
 
 } // end namespace hlp2
@@ -0,0 +1,242 @@
+/*!*************************************************************************
+****
+\file q-bench.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Benchmark of the Pig Latin translation.
+ The function include:
+- main()
+Translates the same random corpus with the original vector-rotating
+to_piglatin, with to_piglatin into one buffer and file to file with
+piglatin_file, checks that all three agree and prints the throughput;
+then runs the file through piglatin_pipeline_file with 1, 2, 4, ...
+workers, printing the throughput and memory high-water marks of each;
+last it builds a dictionary of the corpus words, times building and
+loading it and decoding the translation back, and checks that every word
+decodes to itself or to a word listed before it
+****************************************************************************
+***/
+#include <iostream>
+#include <iomanip>
+#include <cctype>  // tolower, toupper
+#include <chrono>
+#include <cstdio>   // std::remove
+#include <fstream>
+#include <iterator> // std::istreambuf_iterator
+#include <string>
+#include <thread>
+#include <vector>
+#include "q.hpp"
+#include "q-bulk.hpp"
+#include "q-pipeline.hpp"
+#include "q-decode.hpp"
+
+namespace {
+
+  char const INPUT_FILE[] {"q-bench-in.tmp"};
+  char const OUTPUT_FILE[] {"q-bench-out.tmp"};
+  char const DICTIONARY_FILE[] {"q-bench-dict.tmp"};
+  std::size_t const PIPELINE_BLOCK {1 << 18};
+
+  std::string read_file(char const *filename) {
+    std::ifstream input(filename, std::ios_base::in | std::ios_base::binary);
+    return std::string((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  }
+
+  unsigned next_rand(unsigned& seed) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+  }
+
+  double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // the first to_piglatin of this lab, without its commented-out code
+  std::string legacy_piglatin(std::string word) {
+    bool upper = false;
+    if (word[0] >= 65 && word[0] <= 90) {
+      upper = true;
+    }
+    std::vector<char> vect(word.begin(), word.end());
+    std::string vows = "aeiouyAEIOUY";
+    char ch = static_cast<char>(tolower(word[0]));
+    if ((ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u')) {
+      vect.push_back('-');
+      vect.push_back('y');
+      vect.push_back('a');
+      vect.push_back('y');
+      return std::string(vect.begin(), vect.end());
+    } else if (word.find_first_of(vows) <= 100) {
+      ch = vect[0];
+      while (!(ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u' || ch == 'y' || ch == 'A') ||
+             ch == 'E' || ch == 'I' || ch == 'O' || ch == 'U') {
+        char temp = vect[0];
+        vect.erase(vect.begin());
+        vect.push_back(temp);
+        ch = vect[0];
+      }
+      vect.push_back('-');
+      vect.push_back('a');
+      vect.push_back('y');
+      std::string str(vect.begin(), vect.end());
+      if (upper == true) {
+        for (size_t i = 0; i < str.size(); i++) {
+          if (str[i] >= 65 && str[i] <= 90) {
+            str[i] += 32;
+          }
+        }
+        str[0] -= 32;
+      }
+      return str;
+    } else {
+      vect.push_back('-');
+      vect.push_back('w');
+      vect.push_back('a');
+      vect.push_back('y');
+      return std::string(vect.begin(), vect.end());
+    }
+  }
+
+  // the original never returns for a word that rotates without reaching
+  // aeiouy or 'A', so those words are left out of the corpus
+  bool legacy_terminates(std::string const& word) {
+    char ch = static_cast<char>(tolower(word[0]));
+    return ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u' ||
+           word.find_first_of("aeiouyAEIOUY") > 100 || word.find_first_of("aeiouyA") != std::string::npos;
+  }
+
+  // words of 1 to 12 characters, mostly lower case letters, some
+  // capitalized, some with digits, apostrophes or a long run of consonants
+  std::vector<std::string> make_words(std::size_t count) {
+    char const letters[] {"etaoinshrdlcumwfgypbvkjxqz"};
+    std::vector<std::string> words;
+    unsigned seed = 7;
+    while (words.size() < count) {
+      std::size_t len = 1 + next_rand(seed) % 12;
+      std::string word;
+      for (std::size_t i = 0; i < len; i++) {
+        unsigned r = next_rand(seed) % 100;
+        word += r < 3 ? static_cast<char>('0' + r) : r < 4 ? '\'' : letters[next_rand(seed) % (r < 60 ? 9 : 26)];
+      }
+      if (next_rand(seed) % 5 == 0) {
+        word[0] = static_cast<char>(toupper(word[0]));
+      }
+      if (next_rand(seed) % 50 == 0) {
+        word = std::string(20, 'r') + word;
+      }
+      if (legacy_terminates(word)) {
+        words.push_back(word);
+      }
+    }
+    return words;
+  }
+
+} // end anonymous namespace
+
+int main() {
+  std::size_t const num_words {2'000'000};
+  std::vector<std::string> words = make_words(num_words);
+  std::string text;
+  for (std::size_t i = 0; i < words.size(); i++) {
+    text += words[i];
+    text += (i % 12 == 11) ? '\n' : ' ';
+  }
+  double megabytes = static_cast<double>(text.size()) / 1e6;
+
+  auto start = std::chrono::steady_clock::now();
+  std::string legacy;
+  for (std::size_t i = 0; i < words.size(); i++) {
+    legacy += legacy_piglatin(words[i]);
+    legacy += (i % 12 == 11) ? '\n' : ' ';
+  }
+  double legacy_seconds = seconds_since(start);
+
+  start = std::chrono::steady_clock::now();
+  std::string buffered(text.size() + words.size() * hlp2::PIGLATIN_SUFFIX_MAX, '\0');
+  std::size_t used = 0;
+  for (std::size_t i = 0; i < words.size(); i++) {
+    used += hlp2::to_piglatin(words[i], &buffered[used]);
+    buffered[used++] = (i % 12 == 11) ? '\n' : ' ';
+  }
+  buffered.resize(used);
+  double buffered_seconds = seconds_since(start);
+
+  {
+    std::ofstream corpus(INPUT_FILE, std::ios_base::out | std::ios_base::binary);
+    corpus << text;
+  }
+  start = std::chrono::steady_clock::now();
+  bool opened = hlp2::piglatin_file(INPUT_FILE, OUTPUT_FILE);
+  double file_seconds = seconds_since(start);
+  std::string bulk = read_file(OUTPUT_FILE);
+
+  std::cout << std::fixed << std::setprecision(1);
+  std::cout << words.size() << " words, " << megabytes << " MB\n";
+  std::cout << "                     ns/word    MB/s\n";
+  std::cout << "legacy to_piglatin" << std::setw(11) << legacy_seconds * 1e9 / static_cast<double>(words.size())
+            << std::setw(8) << megabytes / legacy_seconds << "\n";
+  std::cout << "to_piglatin(out)  " << std::setw(11) << buffered_seconds * 1e9 / static_cast<double>(words.size())
+            << std::setw(8) << megabytes / buffered_seconds << (buffered == legacy ? "   match" : "   DIFFER") << "\n";
+  std::cout << "piglatin_file     " << std::setw(11) << file_seconds * 1e9 / static_cast<double>(words.size())
+            << std::setw(8) << megabytes / file_seconds << (opened && bulk == legacy ? "   match" : "   DIFFER") << "\n";
+
+  unsigned cores = std::thread::hardware_concurrency();
+  cores = cores ? cores : 1;
+  unsigned max_workers = cores < 4 ? 4 : cores;
+  std::cout << "\npiglatin_pipeline_file, " << PIPELINE_BLOCK / 1024 << " KiB blocks, "
+            << cores << " hardware threads\n";
+  std::cout << "workers    MB/s  peak blocks  peak MB\n";
+  for (unsigned num_workers = 1; num_workers <= max_workers; num_workers *= 2) {
+    hlp2::PipelineStats stats {};
+    opened = hlp2::piglatin_pipeline_file(INPUT_FILE, OUTPUT_FILE, num_workers, PIPELINE_BLOCK, stats);
+    std::cout << std::setw(7) << num_workers << std::setw(8) << megabytes / stats.seconds
+              << std::setw(13) << stats.peak_blocks
+              << std::setw(9) << static_cast<double>(stats.peak_buffer_bytes) / 1e6
+              << (opened && read_file(OUTPUT_FILE) == legacy ? "   match" : "   DIFFER")
+              << (num_workers > cores ? "   (more workers than cores)" : "") << "\n";
+  }
+
+  // the translations of the corpus, with its words as the word list
+  start = std::chrono::steady_clock::now();
+  opened = hlp2::PigLatinDictionary::build(INPUT_FILE, DICTIONARY_FILE);
+  double build_seconds = seconds_since(start);
+  start = std::chrono::steady_clock::now();
+  hlp2::PigLatinDictionary dictionary;
+  bool loaded = opened && dictionary.load(DICTIONARY_FILE);
+  double load_seconds = seconds_since(start);
+
+  std::vector<std::string> pigs(words.size());
+  for (std::size_t i = 0; i < words.size(); i++) {
+    pigs[i] = hlp2::to_piglatin(words[i]);
+  }
+  std::string decoded(64, '\0');
+  std::size_t total = 0;
+  start = std::chrono::steady_clock::now();
+  for (std::string const& pig : pigs) {
+    total += dictionary.decode(pig, &decoded[0]);
+  }
+  double decode_seconds = seconds_since(start);
+
+  // an ambiguous word may decode to another word, but never to a later one
+  std::size_t unresolved = 0, later = 0;
+  for (std::size_t i = 0; i < words.size(); i++) {
+    std::size_t len = dictionary.decode(pigs[i], &decoded[0]);
+    long rank = len ? dictionary.find(std::string_view(decoded.data(), len)) : -1;
+    unresolved += (len == 0);
+    later += (rank < 0 || rank > dictionary.find(words[i]));
+  }
+  std::cout << "\nPigLatinDictionary, " << dictionary.size() << " distinct words\n";
+  std::cout << "build " << build_seconds * 1e3 << " ms, load " << load_seconds * 1e6 << " us\n";
+  std::cout << "decode " << std::setw(8) << decode_seconds * 1e9 / static_cast<double>(pigs.size()) << " ns/word "
+            << std::setw(8) << static_cast<double>(pigs.size()) / decode_seconds / 1e6 << " M words/s"
+            << (loaded && total > 0 && unresolved == 0 && later == 0 ? "   match" : "   DIFFER") << "\n";
+  std::remove(INPUT_FILE);
+  std::remove(OUTPUT_FILE);
+  std::remove(DICTIONARY_FILE);
+}
@@ -0,0 +1,226 @@
+/*!*************************************************************************
+****
+\file q-bulk.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Bulk Pig Latin translation of whole files.
+ The function include:
+- piglatin_block()
+Replaces every word of a block with its translation, keeping the white
+space between words
+- piglatin_cut()
+Where a block read from a longer text ends with a complete word
+- piglatin_stream()
+Streams text through piglatin_block() a block at a time
+- piglatin_file()
+The same for an input and an output file
+****************************************************************************
+***/
+#include "q-bulk.hpp"
+#include <cstdint>
+#include <cstring>  // std::memmove
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define Q_BULK_SSE2
+#endif
+
+namespace
+{
+  std::size_t const BLOCK_SIZE {1 << 16};
+
+  // sets one bit per byte of data[0, end) that is white space, 16 bytes
+  // at a time with SSE2; bits keeps its capacity from block to block
+  void map_spaces(char const *data, std::size_t end, std::vector<std::uint64_t>& bits)
+  {
+    bits.assign(end / 64 + 1, 0);
+    std::size_t i = 0;
+#if defined(Q_BULK_SSE2)
+    for (; i + 16 <= end; i += 16)
+    {
+      __m128i c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i));
+        // '\t'..'\r' as (c - '\t') <= 4 unsigned, or a blank
+      __m128i t = _mm_sub_epi8(c, _mm_set1_epi8('\t'));
+      __m128i space = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(4)), t),
+                                   _mm_cmpeq_epi8(c, _mm_set1_epi8(' ')));
+      bits[i / 64] |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm_movemask_epi8(space))) << (i % 64);
+    }
+#endif
+    for (; i < end; i++)
+    {
+      bits[i / 64] |= static_cast<std::uint64_t>(hlp2::is_space(data[i])) << (i % 64);
+    }
+  }
+
+  // first index from i on that is white space (space true) or not
+  // (space false), or end if there is none
+  std::size_t next_run(std::vector<std::uint64_t> const& bits, std::size_t i, std::size_t end, bool space)
+  {
+    while (i < end)
+    {
+      std::uint64_t word = space ? bits[i / 64] : ~bits[i / 64];
+      word &= ~std::uint64_t {0} << (i % 64);
+      std::size_t base = i - i % 64;
+      if (word != 0)
+      {
+        std::size_t found = base + static_cast<std::size_t>(__builtin_ctzll(word));
+        return found < end ? found : end;
+      }
+      i = base + 64;
+    }
+    return end;
+  }
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Translates a block of text whose words are all complete: each word (a
+run of characters other than white space, as operator>> reads them) is
+written as its Pig Latin, and the white space between words is copied
+as it is. The white space is first mapped to one bit per byte, so words
+are found 64 bytes of bits at a time.
+\param data
+The block
+\param len
+Length of the block
+\param out
+Where the translation is written; words and white space alternate, so
+3 * len + PIGLATIN_SUFFIX_MAX characters are always enough
+\param spaces
+Scratch space for the white space bits, reused from block to block
+\return
+Length of the translation
+****************************************************************************
+***/
+  std::size_t piglatin_block(char const *data, std::size_t len, char *out, std::vector<std::uint64_t>& spaces)
+  {
+    map_spaces(data, len, spaces);
+    char *dst = out;
+    std::size_t i = 0;
+    while (i < len)
+    {
+      std::size_t start = i;
+      if (is_space(data[i]))
+      {
+        i = next_run(spaces, i, len, false);
+        while (start < i)
+        {
+          *dst++ = data[start++];
+        }
+        continue;
+      }
+      i = next_run(spaces, i, len, true);
+      dst += to_piglatin(std::string_view(data + start, i - start), dst);
+    }
+    return static_cast<std::size_t>(dst - out);
+  }
+
+/*!*************************************************************************
+****
+\brief
+Where a block read from the middle of a text can be cut: just after its
+last white space, so the word it ends with, which may go on in the next
+read, is left for later.
+\param data
+The block
+\param len
+Length of the block
+\return
+Length of the part that can be translated now; 0 if it has no white space
+****************************************************************************
+***/
+  std::size_t piglatin_cut(char const *data, std::size_t len)
+  {
+    while (len > 0 && !is_space(data[len - 1]))
+    {
+      len--;
+    }
+    return len;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Translates a whole stream with piglatin_block(). The input is read in
+blocks of 64 KiB, each cut after its last white space; the word cut off
+is moved to the front of the buffer and read on with the next block.
+Each block is translated into one output buffer and written with one
+call. The buffers are only allocated once, unless a single word is
+longer than a block.
+\param input
+Stream of English text
+\param output
+Stream for the translated text
+\return
+void
+****************************************************************************
+***/
+  void piglatin_stream(std::istream& input, std::ostream& output)
+  {
+    std::vector<char> buffer(BLOCK_SIZE);
+    std::vector<std::uint64_t> spaces;
+    std::vector<char> translated;
+    std::size_t carry = 0;   // characters of an unfinished word at the front
+
+    for (;;)
+    {
+      if (carry == buffer.size())
+      {
+        buffer.resize(buffer.size() * 2);
+      }
+      input.read(buffer.data() + carry, static_cast<std::streamsize>(buffer.size() - carry));
+      std::size_t end = carry + static_cast<std::size_t>(input.gcount());
+      bool last = end < buffer.size();
+      std::size_t cut = last ? end : piglatin_cut(buffer.data(), end);
+
+      translated.resize(3 * buffer.size() + PIGLATIN_SUFFIX_MAX);
+      std::size_t length = piglatin_block(buffer.data(), cut, translated.data(), spaces);
+      output.write(translated.data(), static_cast<std::streamsize>(length));
+
+      carry = end - cut;
+      std::memmove(buffer.data(), buffer.data() + cut, carry);
+      if (last)
+      {
+        break;
+      }
+    }
+  }
+
+/*!*************************************************************************
+****
+\brief
+Translates a whole file with piglatin_stream().
+\param input_filename
+Pointer to the name of the English text file
+\param output_filename
+Pointer to the name of the file to write
+\return
+false if either file cannot be opened, or reading or writing fails
+****************************************************************************
+***/
+  bool piglatin_file(char const *input_filename, char const *output_filename)
+  {
+    std::ifstream input(input_filename, std::ios_base::in | std::ios_base::binary);
+    if (!input.is_open())
+    {
+      return false;
+    }
+    std::ofstream output(output_filename, std::ios_base::out | std::ios_base::binary);
+    if (!output.is_open())
+    {
+      return false;
+    }
+    piglatin_stream(input, output);
+    output.close();
+    return !input.bad() && static_cast<bool>(output);
+  }
+}
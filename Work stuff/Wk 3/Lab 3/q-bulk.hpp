@@ -0,0 +1,45 @@
+/*!*************************************************************************
+****
+\file q-bulk.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Bulk Pig Latin translation of whole files.
+ The function include:
+- is_space()
+The white space that separates words, as operator>> skips it
+- piglatin_block()
+Replaces every word of a block with its translation, keeping the white
+space between words
+- piglatin_cut()
+Where a block read from a longer text ends with a complete word
+- piglatin_stream()
+Streams text through piglatin_block() a block at a time
+- piglatin_file()
+The same for an input and an output file
+****************************************************************************
+***/
+#ifndef Q_BULK_HPP_
+#define Q_BULK_HPP_
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "q.hpp"
+
+namespace hlp2 {
+  // same white space set that operator>> skips in the classic locale
+  inline bool is_space(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+  }
+
+  std::size_t piglatin_block(char const *data, std::size_t len, char *out, std::vector<std::uint64_t>& spaces);
+  std::size_t piglatin_cut(char const *data, std::size_t len);
+  void piglatin_stream(std::istream& input, std::ostream& output);
+  bool piglatin_file(char const *input_filename, char const *output_filename);
+}
+#endif
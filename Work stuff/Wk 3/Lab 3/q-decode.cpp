@@ -0,0 +1,658 @@
+/*!*************************************************************************
+****
+\file q-decode.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Pig Latin back to English, resolved against a dictionary of English words.
+ The function include:
+- PigLatinDictionary::build
+Writes the perfect hash dictionary of a word list to a file
+- PigLatinDictionary::load
+Maps a dictionary file written by build
+- PigLatinDictionary::find
+Rank of a word in the word list, in O(word length)
+- PigLatinDictionary::decode
+English of one Pig Latin word
+- PigLatinDictionary::decode_stream
+English of a whole Pig Latin text
+****************************************************************************
+***/
+#include "q-decode.hpp"
+#include "q-bulk.hpp"   // piglatin_cut
+#include <algorithm>    // std::stable_sort
+#include <cstring>      // std::memcmp, std::memcpy, std::memmove
+#include <fstream>
+#include <iterator>     // std::istreambuf_iterator
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <fcntl.h>      // open
+#include <sys/mman.h>   // mmap, munmap
+#include <sys/stat.h>   // fstat
+#include <unistd.h>     // close
+
+namespace
+{
+  // A dictionary file is this header, then num_buckets displacements,
+  // num_slots slots (word index + 1 under an 8 bit tag of the word's hash,
+  // 0 for a free slot), num_words + 1
+  // offsets of the words in the text, and the text of the words back to
+  // back. Native byte order.
+  struct DictionaryHeader
+  {
+    char magic[4];              // "PLDX"
+    std::uint32_t version;
+    std::uint32_t num_words;
+    std::uint32_t num_buckets;
+    std::uint32_t num_slots;
+    std::uint32_t seed;         // of the word hash; 0 unless two words collided
+    std::uint64_t text_bytes;
+  };
+
+  char const MAGIC[4] {'P', 'L', 'D', 'X'};
+  std::uint32_t const VERSION {1};
+  std::uint32_t const KEYS_PER_BUCKET {4};
+  std::uint64_t const GOLDEN {0x9E3779B97F4A7C15ULL};
+  std::size_t const BLOCK_SIZE {1 << 16};
+  // a slot keeps the word index in its low bits and a tag of the hash
+  // above, so most words not in the dictionary miss without its text
+  unsigned const INDEX_BITS {24};
+  std::uint32_t const INDEX_MASK {(1u << INDEX_BITS) - 1};
+  // offsets into the text are 32 bits
+  std::uint64_t const MAX_TEXT_BYTES {0xFFFFFFFFULL};
+  // a bucket that finds no displacement in this many tries holds words
+  // whose hashes collide, so the words are hashed again with a new seed
+  std::uint32_t const MAX_DISPLACEMENT {1u << 20};
+  std::uint32_t const MAX_SEEDS {16};
+
+  inline bool is_upper(char ch)
+  {
+    return ch >= 'A' && ch <= 'Z';
+  }
+
+  inline char to_lower(char ch)
+  {
+    return is_upper(ch) ? static_cast<char>(ch + 32) : ch;
+  }
+
+  // the letters the encoder stops its rotation at, and those it keeps a
+  // word starting with in place
+  inline bool is_stop(char ch)
+  {
+    return ch == 'a' || ch == 'e' || ch == 'i' || ch == 'o' || ch == 'u' || ch == 'y' || ch == 'A';
+  }
+
+  inline bool is_leading(char ch)
+  {
+    char lower = to_lower(ch);
+    return lower == 'a' || lower == 'e' || lower == 'i' || lower == 'o' || lower == 'u';
+  }
+
+  // FNV-1a of first then second, lower-cased, from a basis moved by seed
+  std::uint64_t hash_pieces(std::string_view first, std::string_view second, std::uint32_t seed)
+  {
+    std::uint64_t h {14695981039346656037ULL ^ (seed * GOLDEN)};
+    for (char ch : first)
+    {
+      h = (h ^ static_cast<unsigned char>(to_lower(ch))) * 1099511628211ULL;
+    }
+    for (char ch : second)
+    {
+      h = (h ^ static_cast<unsigned char>(to_lower(ch))) * 1099511628211ULL;
+    }
+    return h;
+  }
+
+  inline std::uint32_t tag_of(std::uint64_t h)
+  {
+    return static_cast<std::uint32_t>(h & 0xFF) << INDEX_BITS;
+  }
+
+  inline std::uint32_t bucket_of(std::uint64_t h, std::uint32_t num_buckets)
+  {
+    return static_cast<std::uint32_t>((h >> 32) % num_buckets);
+  }
+
+  // slot of a key hashed to h in a bucket displaced by d (splitmix64 finalizer)
+  inline std::uint32_t slot_of(std::uint64_t h, std::uint32_t d, std::uint32_t num_slots)
+  {
+    std::uint64_t x = h + d * GOLDEN;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<std::uint32_t>(x % num_slots);
+  }
+
+  // Hash and displace: bucket by bucket, largest first, searches the
+  // displacement that sends every key of the bucket to a free slot of its
+  // own; false if some bucket finds none in MAX_DISPLACEMENT tries.
+  bool place_keys(std::vector<std::uint64_t> const& hashes, std::vector<std::uint32_t>& displacements,
+                  std::vector<std::uint32_t>& slots)
+  {
+    std::uint32_t num_buckets = static_cast<std::uint32_t>(displacements.size());
+    std::uint32_t num_slots = static_cast<std::uint32_t>(slots.size());
+    std::vector<std::vector<std::uint32_t>> buckets(num_buckets);
+    for (std::uint32_t i = 0; i < hashes.size(); i++)
+    {
+      buckets[bucket_of(hashes[i], num_buckets)].push_back(i);
+    }
+    std::vector<std::uint32_t> order(num_buckets);
+    for (std::uint32_t b = 0; b < num_buckets; b++)
+    {
+      order[b] = b;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](std::uint32_t a, std::uint32_t b) {
+      return buckets[a].size() > buckets[b].size();
+    });
+
+    std::fill(displacements.begin(), displacements.end(), 0);
+    std::fill(slots.begin(), slots.end(), 0);
+    std::vector<std::uint32_t> taken;
+    for (std::uint32_t b : order)
+    {
+      std::vector<std::uint32_t> const& keys = buckets[b];
+      if (keys.empty())
+      {
+        break;
+      }
+      std::uint32_t d = 0;
+      for (; d < MAX_DISPLACEMENT; d++)
+      {
+        taken.clear();
+        for (std::uint32_t key : keys)
+        {
+          std::uint32_t s = slot_of(hashes[key], d, num_slots);
+          if (slots[s] != 0 || std::find(taken.begin(), taken.end(), s) != taken.end())
+          {
+            break;
+          }
+          taken.push_back(s);
+        }
+        if (taken.size() == keys.size())
+        {
+          for (std::size_t k = 0; k < keys.size(); k++)
+          {
+            slots[taken[k]] = tag_of(hashes[keys[k]]) | (keys[k] + 1);
+          }
+          displacements[b] = d;
+          break;
+        }
+      }
+      if (d == MAX_DISPLACEMENT)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // the English of a stem with its last moved letters put back in front,
+  // lower-cased with a capital first letter if capital
+  void unrotate(std::string_view stem, std::size_t moved, bool capital, char *out)
+  {
+    std::size_t m = stem.size();
+    std::memcpy(out, stem.data() + m - moved, moved);
+    std::memcpy(out + moved, stem.data(), m - moved);
+    if (capital)
+    {
+      for (std::size_t i = 0; i < m; i++)
+      {
+        out[i] = to_lower(out[i]);
+      }
+      out[0] = static_cast<char>(out[0] - 32);
+    }
+  }
+
+  // whether to_piglatin() turns english into pig; a dictionary word found
+  // for a Pig Latin word is only its English if this holds
+  bool encodes_to(std::string_view english, std::string_view pig)
+  {
+    char small[64];
+    std::string large;
+    char *buffer = small;
+    if (english.size() + hlp2::PIGLATIN_SUFFIX_MAX > sizeof(small))
+    {
+      large.resize(english.size() + hlp2::PIGLATIN_SUFFIX_MAX);
+      buffer = &large[0];
+    }
+    std::size_t length = hlp2::to_piglatin(english, buffer);
+    return std::string_view(buffer, length) == pig;
+  }
+
+  template <typename T>
+  void write_array(std::ostream& output, std::vector<T> const& values)
+  {
+    output.write(reinterpret_cast<char const*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+  }
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Builds the dictionary of a word list and writes it to a file. The words
+(white space separated, lower-cased, repeats left out) keep their list
+order as their rank. They are hashed into about n / 4 buckets; bucket by
+bucket, largest first, a displacement is searched that sends every key of
+the bucket to a free slot of its own, out of n + n / 8 slots (hash and
+displace). A bucket whose words share a hash finds no displacement, so
+after MAX_DISPLACEMENT tries the words are hashed again with the next
+seed, kept in the header. A lookup then needs the hash of the word, its
+bucket's displacement, one slot and one compare.
+\param word_list_filename
+Pointer to the name of the word list
+\param dictionary_filename
+Pointer to the name of the dictionary file to write
+\return
+false if the list cannot be read, has 16M words or more or more than
+4 GiB of distinct words, no seed places every word, or the dictionary
+cannot be written
+****************************************************************************
+***/
+  bool PigLatinDictionary::build(char const *word_list_filename, char const *dictionary_filename)
+  {
+    std::ifstream list(word_list_filename, std::ios_base::in | std::ios_base::binary);
+    if (!list.is_open())
+    {
+      return false;
+    }
+    std::string all((std::istreambuf_iterator<char>(list)), std::istreambuf_iterator<char>());
+    for (char& ch : all)
+    {
+      ch = to_lower(ch);
+    }
+
+    std::vector<std::string_view> words;
+    std::unordered_set<std::string_view> seen;
+    std::uint64_t text_bytes = 0;
+    for (std::size_t i = 0; i < all.size();)
+    {
+      while (i < all.size() && is_space(all[i]))
+      {
+        i++;
+      }
+      std::size_t start = i;
+      while (i < all.size() && !is_space(all[i]))
+      {
+        i++;
+      }
+      std::string_view word(all.data() + start, i - start);
+      if (!word.empty() && seen.insert(word).second)
+      {
+        words.push_back(word);
+        text_bytes += word.size();
+      }
+    }
+
+    if (words.size() >= INDEX_MASK || text_bytes > MAX_TEXT_BYTES)
+    {
+      return false;
+    }
+    std::uint32_t n = static_cast<std::uint32_t>(words.size());
+    std::uint32_t num_buckets = n / KEYS_PER_BUCKET + 1;
+    std::uint32_t num_slots = n + n / 8 + 1;
+    std::vector<std::uint64_t> hashes(n);
+    std::vector<std::uint32_t> displacements(num_buckets, 0);
+    std::vector<std::uint32_t> slots(num_slots, 0);
+    std::uint32_t seed = 0;
+    for (;; seed++)
+    {
+      if (seed == MAX_SEEDS)
+      {
+        return false;
+      }
+      for (std::uint32_t i = 0; i < n; i++)
+      {
+        hashes[i] = hash_pieces(words[i], std::string_view(), seed);
+      }
+      if (place_keys(hashes, displacements, slots))
+      {
+        break;
+      }
+    }
+
+    std::vector<std::uint32_t> offsets(static_cast<std::size_t>(n) + 1, 0);
+    std::string text;
+    for (std::uint32_t i = 0; i < n; i++)
+    {
+      text += words[i];
+      offsets[i + 1] = static_cast<std::uint32_t>(text.size());
+    }
+
+    std::ofstream output(dictionary_filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    if (!output.is_open())
+    {
+      return false;
+    }
+    DictionaryHeader header {{MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]}, VERSION, n, num_buckets, num_slots, seed,
+                             text.size()};
+    output.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    write_array(output, displacements);
+    write_array(output, slots);
+    write_array(output, offsets);
+    output.write(text.data(), static_cast<std::streamsize>(text.size()));
+    return static_cast<bool>(output);
+  }
+
+/*!*************************************************************************
+****
+\brief
+Maps a dictionary file read-only; the tables are used where they are in
+the mapping, so loading costs the same whatever the size of the list.
+\param dictionary_filename
+Pointer to the name of a file written by build()
+\return
+false if the file cannot be mapped or is not a dictionary
+****************************************************************************
+***/
+  bool PigLatinDictionary::load(char const *dictionary_filename)
+  {
+    unload();
+    int fd = open(dictionary_filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(DictionaryHeader)))
+    {
+      close(fd);
+      return false;
+    }
+    std::size_t bytes = static_cast<std::size_t>(info.st_size);
+    void *base = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+      return false;
+    }
+
+    DictionaryHeader const& header = *static_cast<DictionaryHeader const*>(base);
+    std::uint64_t tables = sizeof(DictionaryHeader) + 4ULL * (static_cast<std::uint64_t>(header.num_buckets)
+                                                              + header.num_slots + header.num_words + 1);
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+        header.num_buckets == 0 || header.num_slots == 0 || header.num_words >= INDEX_MASK || tables + header.text_bytes != bytes)
+    {
+      munmap(base, bytes);
+      return false;
+    }
+
+    char const *data = static_cast<char const*>(base);
+    image = base;
+    image_bytes = bytes;
+    num_words = header.num_words;
+    num_buckets = header.num_buckets;
+    num_slots = header.num_slots;
+    seed = header.seed;
+    displacements = reinterpret_cast<std::uint32_t const*>(data + sizeof(DictionaryHeader));
+    slots = displacements + num_buckets;
+    offsets = slots + num_slots;
+    text = reinterpret_cast<char const*>(offsets + num_words + 1);
+    if (offsets[num_words] != header.text_bytes)
+    {
+      unload();
+      return false;
+    }
+    return true;
+  }
+
+  PigLatinDictionary::~PigLatinDictionary()
+  {
+    unload();
+  }
+
+  void PigLatinDictionary::unload()
+  {
+    if (image != nullptr)
+    {
+      munmap(image, image_bytes);
+    }
+    image = nullptr;
+    image_bytes = 0;
+    num_words = num_buckets = num_slots = seed = 0;
+    displacements = slots = offsets = nullptr;
+    text = nullptr;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Number of words in the dictionary.
+\return
+The word count, repeats of the list left out
+****************************************************************************
+***/
+  std::uint32_t PigLatinDictionary::size() const
+  {
+    return num_words;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Looks a word up in any case.
+\param word
+The word
+\return
+Its position in the word list, repeats left out, or -1
+****************************************************************************
+***/
+  long PigLatinDictionary::find(std::string_view word) const
+  {
+    return find(word, std::string_view());
+  }
+
+    // the word first + second, without putting the two together
+  long PigLatinDictionary::find(std::string_view first, std::string_view second) const
+  {
+    if (image == nullptr)
+    {
+      return -1;
+    }
+    std::uint64_t h = hash_pieces(first, second, seed);
+    std::uint32_t slot = slots[slot_of(h, displacements[bucket_of(h, num_buckets)], num_slots)];
+    std::uint32_t index = slot & INDEX_MASK;
+    if (index == 0 || (slot & ~INDEX_MASK) != tag_of(h))
+    {
+      return -1;
+    }
+    char const *word = text + offsets[index - 1];
+    if (offsets[index] - offsets[index - 1] != first.size() + second.size())
+    {
+      return -1;
+    }
+    for (char ch : first)
+    {
+      if (*word++ != to_lower(ch))
+      {
+        return -1;
+      }
+    }
+    for (char ch : second)
+    {
+      if (*word++ != to_lower(ch))
+      {
+        return -1;
+      }
+    }
+    return static_cast<long>(index) - 1;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Turns one word of to_piglatin() back into English. "-yay" and "-way"
+words are the English word with the suffix, which must be in the
+dictionary and encode back to pig. An "-ay" word is the English
+word rotated at its first aeiouy or 'A', so the letters moved to the end
+are some run at the end of the stem without such a letter; every such
+run (in a capitalized word, any run without an 'a', since the upper case
+E, I, O, U and Y that do not stop the rotation were lower-cased) is
+moved back and looked up, and the candidate earliest in the word list
+wins. Every candidate is encoded again and kept only if that gives back
+pig, so a word the encoder would have given another suffix or rotation
+(one with a stop letter too far in, say) does not decode. A capitalized word comes back lower-case with a capital first
+letter, as the encoder left it; a stem starting with 'A' may be either.
+\param pig
+The Pig Latin word
+\param out
+Where the English is written (room for pig.size() characters)
+\return
+Length of the English, or 0 if pig does not decode to a dictionary word
+****************************************************************************
+***/
+  std::size_t PigLatinDictionary::decode(std::string_view pig, char *out) const
+  {
+    std::size_t n = pig.size();
+    if (n > 4 && (pig.compare(n - 4, 4, "-yay") == 0 || pig.compare(n - 4, 4, "-way") == 0))
+    {
+      std::string_view english = pig.substr(0, n - 4);
+      if (find(english) < 0 || !encodes_to(english, pig))
+      {
+        return 0;
+      }
+      std::memcpy(out, english.data(), english.size());
+      return english.size();
+    }
+    if (n <= 3 || pig.compare(n - 3, 3, "-ay") != 0)
+    {
+      return 0;
+    }
+
+    std::string_view stem = pig.substr(0, n - 3);
+    std::size_t m = stem.size();
+    bool lower_rest = true;   // a capitalized word is lower case after its first letter
+    for (std::size_t i = 1; i < m && lower_rest; i++)
+    {
+      lower_rest = !is_upper(stem[i]);
+    }
+
+      // an uncapitalized word rotated to its 'A' also starts with a capital,
+      // so a stem starting with 'A' is read both ways, the capitalized
+      // reading first as it is by far the likelier on a tie
+    long best = -1;
+    std::size_t best_moved = 0;
+    bool capital = false;
+    std::string candidate(m, '\0');
+    for (int reading = 0; reading < 2; reading++)
+    {
+      bool as_capital = reading == 0;
+      if (as_capital ? !(is_upper(stem[0]) && lower_rest) : (is_upper(stem[0]) && stem[0] != 'A'))
+      {
+        continue;
+      }
+      std::size_t run = 0;   // letters at the end of the stem that may have moved
+      while (run + 1 < m && (as_capital ? to_lower(stem[m - 1 - run]) != 'a' : !is_stop(stem[m - 1 - run])))
+      {
+        run++;
+      }
+      for (std::size_t moved = (stem[0] == 'y') ? 0 : 1; moved <= run; moved++)
+      {
+        std::string_view front = stem.substr(m - moved);
+        std::string_view back = stem.substr(0, m - moved);
+        char first = moved ? front[0] : back[0];
+          // the English starts with a consonant, a capital one (lower-cased
+          // since) only if the Pig Latin is capitalized
+        if (is_leading(first) || (as_capital ? !(first >= 'a' && first <= 'z') : is_upper(first)))
+        {
+          continue;
+        }
+        long rank = find(front, back);
+        if (rank < 0 || (best >= 0 && rank >= best))
+        {
+          continue;
+        }
+        unrotate(stem, moved, as_capital, &candidate[0]);
+        if (encodes_to(candidate, pig))
+        {
+          best = rank;
+          best_moved = moved;
+          capital = as_capital;
+        }
+      }
+    }
+    if (best < 0)
+    {
+      return 0;
+    }
+
+    unrotate(stem, best_moved, capital, out);
+    return m;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Decodes a whole text a 64 KiB block at a time, each block cut after its
+last white space like piglatin_stream(). White space is copied as it is,
+and a word that does not decode is copied as it is.
+\param input
+Stream of Pig Latin text
+\param output
+Stream for the English text
+\return
+Number of words that did not decode
+****************************************************************************
+***/
+  unsigned long long PigLatinDictionary::decode_stream(std::istream& input, std::ostream& output) const
+  {
+    std::vector<char> buffer(BLOCK_SIZE);
+    std::vector<char> decoded(BLOCK_SIZE);
+    std::size_t carry = 0;
+    unsigned long long unknown = 0;
+    for (;;)
+    {
+      if (carry == buffer.size())
+      {
+        buffer.resize(buffer.size() * 2);
+        decoded.resize(buffer.size());
+      }
+      input.read(buffer.data() + carry, static_cast<std::streamsize>(buffer.size() - carry));
+      std::size_t end = carry + static_cast<std::size_t>(input.gcount());
+      bool last = end < buffer.size();
+      std::size_t cut = last ? end : piglatin_cut(buffer.data(), end);
+
+      char const *data = buffer.data();
+      char *dst = decoded.data();
+      for (std::size_t i = 0; i < cut;)
+      {
+        std::size_t start = i;
+        if (is_space(data[i]))
+        {
+          while (i < cut && is_space(data[i]))
+          {
+            *dst++ = data[i++];
+          }
+          continue;
+        }
+        while (i < cut && !is_space(data[i]))
+        {
+          i++;
+        }
+        std::size_t len = decode(std::string_view(data + start, i - start), dst);
+        if (len == 0)
+        {
+          std::memcpy(dst, data + start, i - start);
+          len = i - start;
+          unknown++;
+        }
+        dst += len;
+      }
+      output.write(decoded.data(), static_cast<std::streamsize>(dst - decoded.data()));
+
+      carry = end - cut;
+      std::memmove(buffer.data(), buffer.data() + cut, carry);
+      if (last)
+      {
+        break;
+      }
+    }
+    return unknown;
+  }
+}
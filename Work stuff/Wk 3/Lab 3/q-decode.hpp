@@ -0,0 +1,77 @@
+/*!*************************************************************************
+****
+\file q-decode.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Pig Latin back to English, resolved against a dictionary of English words.
+ The function include:
+- PigLatinDictionary::build
+Writes the perfect hash dictionary of a word list to a file
+- PigLatinDictionary::load
+Maps a dictionary file written by build
+- PigLatinDictionary::find
+Rank of a word in the word list, in O(word length)
+- PigLatinDictionary::decode
+English of one Pig Latin word
+- PigLatinDictionary::decode_stream
+English of a whole Pig Latin text
+****************************************************************************
+***/
+#ifndef Q_DECODE_HPP_
+#define Q_DECODE_HPP_
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include "q.hpp"
+
+namespace hlp2 {
+  // The words of a list, lower-cased, under a perfect hash: every word has
+  // a slot of its own, so a lookup is one hash of the word, one slot and
+  // one compare. The tables are a single file that load() maps as it is.
+  class PigLatinDictionary {
+  public:
+    PigLatinDictionary() = default;
+    ~PigLatinDictionary();
+    PigLatinDictionary(PigLatinDictionary const&) = delete;
+    PigLatinDictionary& operator=(PigLatinDictionary const&) = delete;
+
+    // false if the list cannot be read, has 16M words or more or over
+    // 4 GiB of text, cannot be hashed without collisions, or the file
+    // cannot be written
+    static bool build(char const *word_list_filename, char const *dictionary_filename);
+    // false if the file cannot be mapped or is not a dictionary
+    bool load(char const *dictionary_filename);
+
+    std::uint32_t size() const;
+    // position in the list (duplicates left out) of word, any case, or -1
+    long find(std::string_view word) const;
+    // writes the English of pig to out (room for pig.size()) and returns
+    // its length, or 0 if pig is not Pig Latin of a word in the dictionary
+    std::size_t decode(std::string_view pig, char *out) const;
+    // decodes every word of a text, keeping the white space; words that do
+    // not decode are copied as they are and counted
+    unsigned long long decode_stream(std::istream& input, std::ostream& output) const;
+
+  private:
+    long find(std::string_view first, std::string_view second) const;
+    void unload();
+
+    void *image = nullptr;
+    std::size_t image_bytes = 0;
+    std::uint32_t num_words = 0;
+    std::uint32_t num_buckets = 0;
+    std::uint32_t num_slots = 0;
+    std::uint32_t seed = 0;
+    std::uint32_t const *displacements = nullptr;
+    std::uint32_t const *slots = nullptr;
+    std::uint32_t const *offsets = nullptr;
+    char const *text = nullptr;
+  };
+}
+#endif
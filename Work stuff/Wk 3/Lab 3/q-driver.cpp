@@ -15,12 +15,98 @@
 #include <fstream>  // std::ifstream
 #include <vector>   // std::vector<std::string>
 #include <iterator> // std::istream_iterator<std::string>
+#include <stdexcept> // std::logic_error
 #include "q.hpp"    // to_piglatin
+#include "q-bulk.hpp" // piglatin_file
+#include "q-pipeline.hpp" // piglatin_pipeline_file
+#include "q-decode.hpp" // PigLatinDictionary
 
 int main(int argc, char *argv[]) {
   // sanity test to make sure program usage is correct
   if (argc < 3) {
     std::cout << "Usage: ./q.out input-text-file your-output-text-file\n";
+    std::cout << "       ./q.out -bulk input-text-file your-output-text-file\n";
+    std::cout << "       ./q.out -pipeline num-workers input-text-file your-output-text-file [block-size]\n";
+    std::cout << "       ./q.out -dictionary word-list-file your-dictionary-file\n";
+    std::cout << "       ./q.out -decode dictionary-file input-text-file your-output-text-file\n";
+    return 0;
+  }
+
+  // dictionary mode: the perfect hash of a word list, written once for -decode
+  if (std::string(argv[1]) == "-dictionary") {
+    if (argc < 4) {
+      std::cout << "Usage: ./q.out -dictionary word-list-file your-dictionary-file\n";
+      return 0;
+    }
+    if (!hlp2::PigLatinDictionary::build(argv[2], argv[3])) {
+      std::cout << "Unable to build a dictionary of " << argv[2] << " into " << argv[3] << std::endl;
+    }
+    return 0;
+  }
+
+  // decode mode: a Pig Latin text back to English, word by word
+  if (std::string(argv[1]) == "-decode") {
+    if (argc < 5) {
+      std::cout << "Usage: ./q.out -decode dictionary-file input-text-file your-output-text-file\n";
+      return 0;
+    }
+    hlp2::PigLatinDictionary dictionary;
+    if (!dictionary.load(argv[2])) {
+      std::cout << "Unable to load dictionary " << argv[2] << std::endl;
+      return 0;
+    }
+    std::ifstream input {argv[3], std::ios_base::in | std::ios_base::binary};
+    std::ofstream output {argv[4], std::ios_base::out | std::ios_base::binary};
+    if (!input || !output) {
+      std::cout << "Unable to open " << argv[3] << " or " << argv[4] << std::endl;
+      return 0;
+    }
+    // words left as they were go to stderr so the output file can be diffed
+    unsigned long long unknown = dictionary.decode_stream(input, output);
+    if (unknown) {
+      std::cerr << unknown << " words not in the dictionary\n";
+    }
+    return 0;
+  }
+
+  // bulk mode: the whole text with every word translated in place
+  if (std::string(argv[1]) == "-bulk") {
+    if (argc < 4) {
+      std::cout << "Usage: ./q.out -bulk input-text-file your-output-text-file\n";
+      return 0;
+    }
+    if (!hlp2::piglatin_file(argv[2], argv[3])) {
+      std::cout << "Unable to read " << argv[2] << " or write " << argv[3] << std::endl;
+    }
+    return 0;
+  }
+
+  // pipeline mode: the same output as bulk mode, translated on worker threads
+  if (std::string(argv[1]) == "-pipeline") {
+    if (argc < 5) {
+      std::cout << "Usage: ./q.out -pipeline num-workers input-text-file your-output-text-file [block-size]\n";
+      return 0;
+    }
+    int num_workers = 0;
+    std::size_t block_size = std::size_t {1} << 20;
+    try {
+      num_workers = std::stoi(argv[2]);
+      block_size = (argc > 5) ? std::stoul(argv[5]) : block_size;
+    } catch (std::logic_error const&) {   // not a number, or out of range
+      std::cout << "Usage: ./q.out -pipeline num-workers input-text-file your-output-text-file [block-size]\n";
+      return 0;
+    }
+    hlp2::PipelineStats stats;
+    if (!hlp2::piglatin_pipeline_file(argv[3], argv[4], num_workers < 0 ? 0 : static_cast<unsigned>(num_workers),
+                                      block_size, stats)) {
+      std::cout << "Unable to read " << argv[3] << " or write " << argv[4] << std::endl;
+      return 0;
+    }
+    // timing and memory go to stderr so the output file can be diffed
+    std::cerr << std::fixed << std::setprecision(1) << stats.blocks << " blocks, "
+              << static_cast<double>(stats.bytes_in) / 1e6 / stats.seconds << " MB/s, at most "
+              << stats.peak_blocks << " blocks and "
+              << static_cast<double>(stats.peak_buffer_bytes) / 1e6 << " MB in flight\n";
     return 0;
   }
 
@@ -0,0 +1,353 @@
+/*!*************************************************************************
+****
+\file q-pipeline.cpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Pig Latin translation of large texts on a pipeline of threads.
+ The function include:
+- piglatin_pipeline()
+Reads the input in blocks, translates them on a pool of workers and
+writes them back in input order, with a bounded number of blocks in flight
+- piglatin_pipeline_file()
+The same for an input and an output file
+****************************************************************************
+***/
+#include "q-pipeline.hpp"
+#include "q-bulk.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>    // std::memcpy
+#include <deque>
+#include <exception>  // std::exception_ptr
+#include <functional> // std::ref
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  // one block on its way through the pipeline; a fixed set of slots is
+  // handed round, so they also bound the memory in flight
+  struct Slot
+  {
+    std::vector<char> input;
+    std::size_t length;
+    std::vector<char> output;
+    std::size_t output_length;
+    unsigned long long sequence;
+  };
+
+  // blocking FIFO of slots; pop() gives nullptr once it is closed and empty.
+  // It never holds more than the slots there are, so push() never waits.
+  class SlotQueue
+  {
+  public:
+    void push(Slot *slot)
+    {
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        slots.push_back(slot);
+      }
+      ready.notify_one();
+    }
+
+    Slot *pop()
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      ready.wait(guard, [this] { return !slots.empty() || closed; });
+      if (slots.empty())
+      {
+        return nullptr;
+      }
+      Slot *slot = slots.front();
+      slots.pop_front();
+      return slot;
+    }
+
+    void close()
+    {
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        closed = true;
+      }
+      ready.notify_all();
+    }
+
+  private:
+    std::mutex lock;
+    std::condition_variable ready;
+    std::deque<Slot*> slots;
+    bool closed = false;
+  };
+
+  // the first exception any stage caught, rethrown once all are joined
+  class Failure
+  {
+  public:
+    void record(std::exception_ptr error)
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      first = first ? first : error;
+    }
+
+    void rethrow()
+    {
+      if (first)
+      {
+        std::rethrow_exception(first);
+      }
+    }
+
+  private:
+    std::mutex lock;
+    std::exception_ptr first;
+  };
+
+  // A block that fails to translate still goes on to the writer, empty,
+  // so the writer can hand every slot back and the pipeline drains.
+  void translator(SlotQueue& work, SlotQueue& done, Failure& failure)
+  {
+    std::vector<std::uint64_t> spaces;
+    for (Slot *slot = work.pop(); slot != nullptr; slot = work.pop())
+    {
+      try
+      {
+          // sized for the longest translation of a full block, so it is
+          // only allocated once per slot
+        std::size_t need = 3 * slot->input.size() + hlp2::PIGLATIN_SUFFIX_MAX;
+        if (slot->output.size() < need)
+        {
+          slot->output.resize(need);
+        }
+        slot->output_length = hlp2::piglatin_block(slot->input.data(), slot->length, slot->output.data(), spaces);
+      }
+      catch (...)
+      {
+        failure.record(std::current_exception());
+        slot->output_length = 0;
+      }
+      done.push(slot);
+    }
+  }
+
+  // writes the translated blocks in sequence order, parking the ones that
+  // finish early, and hands each written slot back to the reader
+  void writer(std::ostream& output, std::size_t num_slots, SlotQueue& done, SlotQueue& free_slots,
+              unsigned long long& bytes_out, std::atomic<unsigned long long>& written, Failure& failure)
+  {
+    std::vector<Slot*> parked(num_slots, nullptr);
+    unsigned long long next = 0;
+    for (Slot *slot = done.pop(); slot != nullptr; slot = done.pop())
+    {
+      parked[slot->sequence % num_slots] = slot;
+      for (Slot *ready = parked[next % num_slots]; ready != nullptr && ready->sequence == next;
+           ready = parked[next % num_slots])
+      {
+        try
+        {
+          output.write(ready->output.data(), static_cast<std::streamsize>(ready->output_length));
+          bytes_out += ready->output_length;
+        }
+        catch (...)
+        {
+          failure.record(std::current_exception());
+        }
+        parked[next % num_slots] = nullptr;
+        next++;
+        written.store(next, std::memory_order_relaxed);
+        free_slots.push(ready);
+      }
+    }
+  }
+
+  // Joins the stages on every way out of piglatin_pipeline(), including an
+  // exception in the reader: closing work lets the workers finish the
+  // blocks already read, then closing done lets the writer finish, so no
+  // thread is left joinable.
+  class Stages
+  {
+  public:
+    Stages(SlotQueue& work, SlotQueue& done) : work(work), done(done) {}
+    Stages(Stages const&) = delete;
+    Stages& operator=(Stages const&) = delete;
+    ~Stages()
+    {
+      join();
+    }
+
+    void join()
+    {
+      work.close();
+      for (std::thread& worker : workers)
+      {
+        if (worker.joinable())
+        {
+          worker.join();
+        }
+      }
+      done.close();
+      if (writing.joinable())
+      {
+        writing.join();
+      }
+    }
+
+    std::thread writing;
+    std::vector<std::thread> workers;
+
+  private:
+    SlotQueue& work;
+    SlotQueue& done;
+  };
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Translates a whole stream on three stages: this thread reads blocks and
+cuts each after its last white space (see piglatin_cut()), a pool of
+workers translates them with piglatin_block(), and a writer thread puts
+them back in input order. The stages pass a fixed set of block slots
+between them, so at most max_blocks blocks are read but not yet written
+and the reader waits for the writer when they are all in use. Since every
+block is cut between words, the output is byte for byte that of
+piglatin_stream(). If a stage throws, every thread is still joined and
+the first exception is rethrown; the output then holds only part of the
+text.
+\param input
+Stream of English text
+\param output
+Stream for the translated text
+\param num_workers
+Translating threads; 0 picks the number of hardware threads
+\param block_size
+Bytes read per block; a block grows if a single word is longer
+\param max_blocks
+Slots in the pipeline; 0 picks 2 per worker plus 2, enough to keep the
+workers busy while the reader and the writer each hold one
+\return
+Sizes, time and memory high-water marks of the run
+****************************************************************************
+***/
+  PipelineStats piglatin_pipeline(std::istream& input, std::ostream& output, unsigned num_workers,
+                                  std::size_t block_size, std::size_t max_blocks)
+  {
+    if (num_workers == 0)
+    {
+      num_workers = std::thread::hardware_concurrency();
+      num_workers = num_workers ? num_workers : 1;
+    }
+    block_size = block_size ? block_size : 1;
+    max_blocks = max_blocks ? max_blocks : 2 * num_workers + 2;
+
+    auto start = std::chrono::steady_clock::now();
+    PipelineStats stats {0, 0, 0, 0, 0, 0.0};
+    std::vector<Slot> slots(max_blocks, Slot {{}, 0, {}, 0, 0});
+    SlotQueue free_slots, work, done;
+    for (Slot& slot : slots)
+    {
+      free_slots.push(&slot);
+    }
+
+    std::atomic<unsigned long long> written {0};
+    Failure failure;
+    Stages stages(work, done);
+    stages.writing = std::thread(writer, std::ref(output), max_blocks, std::ref(done), std::ref(free_slots),
+                                 std::ref(stats.bytes_out), std::ref(written), std::ref(failure));
+    for (unsigned i = 0; i < num_workers; i++)
+    {
+      stages.workers.emplace_back(translator, std::ref(work), std::ref(done), std::ref(failure));
+    }
+
+      // the reader: the word cut off the end of a block starts the next one
+    std::vector<char> carry;
+    bool last = false;
+    while (!last)
+    {
+      Slot *slot = free_slots.pop();
+      if (slot->input.size() < block_size)
+      {
+        slot->input.resize(block_size);
+      }
+      while (slot->input.size() < carry.size())
+      {
+        slot->input.resize(slot->input.size() * 2);
+      }
+      std::memcpy(slot->input.data(), carry.data(), carry.size());
+      std::size_t end = carry.size();
+      for (;;)
+      {
+        input.read(slot->input.data() + end, static_cast<std::streamsize>(slot->input.size() - end));
+        end += static_cast<std::size_t>(input.gcount());
+        stats.bytes_in += static_cast<unsigned long long>(input.gcount());
+        last = end < slot->input.size();
+        slot->length = last ? end : piglatin_cut(slot->input.data(), end);
+        if (slot->length > 0 || last)
+        {
+          break;
+        }
+        slot->input.resize(slot->input.size() * 2);   // one word fills the block
+      }
+      carry.assign(slot->input.data() + slot->length, slot->input.data() + end);
+      slot->sequence = stats.blocks++;
+      work.push(slot);
+      std::size_t in_flight = static_cast<std::size_t>(stats.blocks - written.load(std::memory_order_relaxed));
+      stats.peak_blocks = in_flight > stats.peak_blocks ? in_flight : stats.peak_blocks;
+    }
+    stages.join();
+    failure.rethrow();
+
+      // buffers only grow, so what they hold at the end is the high-water mark
+    stats.peak_buffer_bytes = carry.capacity();
+    for (Slot const& slot : slots)
+    {
+      stats.peak_buffer_bytes += slot.input.capacity() + slot.output.capacity();
+    }
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+  }
+
+/*!*************************************************************************
+****
+\brief
+Translates a whole file with piglatin_pipeline().
+\param input_filename
+Pointer to the name of the English text file
+\param output_filename
+Pointer to the name of the file to write
+\param num_workers
+Translating threads; 0 picks the number of hardware threads
+\param block_size
+Bytes read per block
+\param stats
+Set to the statistics of the run
+\return
+false if either file cannot be opened, or reading or writing fails
+****************************************************************************
+***/
+  bool piglatin_pipeline_file(char const *input_filename, char const *output_filename,
+                              unsigned num_workers, std::size_t block_size, PipelineStats& stats)
+  {
+    std::ifstream input(input_filename, std::ios_base::in | std::ios_base::binary);
+    if (!input.is_open())
+    {
+      return false;
+    }
+    std::ofstream output(output_filename, std::ios_base::out | std::ios_base::binary);
+    if (!output.is_open())
+    {
+      return false;
+    }
+    stats = piglatin_pipeline(input, output, num_workers, block_size);
+    output.close();
+    return !input.bad() && static_cast<bool>(output);
+  }
+}
@@ -0,0 +1,42 @@
+/*!*************************************************************************
+****
+\file q-pipeline.hpp
+\author Kaushik Thirumavalavan
+\par DP email: 2200927\@sit.singaporetech.edu.sg
+\par Course: RSE1202
+\par Section: 2201526
+\par Lab 3: Problem solving with strings
+\date 17-10-2026
+\brief
+Pig Latin translation of large texts on a pipeline of threads.
+ The function include:
+- piglatin_pipeline()
+Reads the input in blocks, translates them on a pool of workers and
+writes them back in input order, with a bounded number of blocks in flight
+- piglatin_pipeline_file()
+The same for an input and an output file
+****************************************************************************
+***/
+#ifndef Q_PIPELINE_HPP_
+#define Q_PIPELINE_HPP_
+#include <istream>
+#include <ostream>
+#include "q.hpp"
+
+namespace hlp2 {
+  // what a pipeline run did and the most memory it held
+  struct PipelineStats {
+    unsigned long long bytes_in;
+    unsigned long long bytes_out;
+    unsigned long long blocks;
+    std::size_t peak_blocks;        // blocks read but not yet written, at most
+    std::size_t peak_buffer_bytes;  // input and output buffers held, at most
+    double seconds;
+  };
+
+  PipelineStats piglatin_pipeline(std::istream& input, std::ostream& output, unsigned num_workers = 0,
+                                  std::size_t block_size = 1 << 20, std::size_t max_blocks = 0);
+  bool piglatin_pipeline_file(char const *input_filename, char const *output_filename,
+                              unsigned num_workers, std::size_t block_size, PipelineStats& stats);
+}
+#endif
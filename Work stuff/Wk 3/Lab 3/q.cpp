@@ -1,137 +1,197 @@
 /*!*************************************************************************
 ****
-\file ocean.cpp
+\file q.cpp
 \author Kaushik Thirumavalavan
 \par DP email: 2200927\@sit.singaporetech.edu.sg
 \par Course: RSE1202
 \par Section: 2201526
-\par Assignment 2: Battleship
+\par Lab 3: Problem solving with strings
 \date 19-01-2023
 \brief
+Translates English words to Pig Latin.
+ The function include:
+- to_piglatin(std::string_view, char*)
+Writes the Pig Latin of a word to a caller's buffer, without allocating
+- to_piglatin(std::string_view)
+The same translation returned as a std::string
 ****************************************************************************
 ***/
 #include "q.hpp"
-#include <iostream> // std::cout
-#include <iomanip>  // std::setw, std::endl 
-#include <string>   // std::string
-#include <fstream>  // std::ifstream
-#include <vector>   // std::vector<std::string>
-#include <iterator> // std::istream_iterato
+#include <cstring>  // std::memcpy
 
- 
- 
- namespace hlp2{
- std::string to_piglatin(std::string word){
-    bool upper = false;
-    if(word[0]>=65 && word[0]<= 90){
-       upper = true;
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define Q_PIGLATIN_SSE2
+#endif
+
+namespace
+{
+  // character classes of the translation, one bit each
+  unsigned char const LEADING {1};  // aeiouAEIOU: a word starting with one takes "-yay"
+  unsigned char const VOWEL {2};    // aeiouyAEIOUY: a word with none takes "-way"
+  unsigned char const STOP {4};     // aeiouyA: the consonant rotation stops here
+  unsigned char const UPPER {8};    // A-Z
+
+  // a vowel further in than this does not count, so the word takes "-way"
+  std::size_t const LAST_VOWEL {100};
+
+  struct CharTable
+  {
+    unsigned char flags[256];
+
+    constexpr CharTable() : flags {}
+    {
+      char const vowels[] {"aeiou"};
+      for (int i = 0; i < 5; i++)
+      {
+        unsigned char lower = static_cast<unsigned char>(vowels[i]);
+        flags[lower] |= LEADING | VOWEL | STOP;
+        flags[lower - 32] |= LEADING | VOWEL;
+      }
+      flags[static_cast<unsigned char>('y')] |= VOWEL | STOP;
+      flags[static_cast<unsigned char>('Y')] |= VOWEL;
+      flags[static_cast<unsigned char>('A')] |= STOP;
+      for (int c = 'A'; c <= 'Z'; c++)
+      {
+        flags[c] |= UPPER;
+      }
     }
-    std::vector<char> vect(word.begin(), word.end());
-   // std::vector<char> vowels{'a','e','i','o','u'};
-    std::string vows = "aeiouyAEIOUY";
-    char ch = tolower(word[0]);
-    if((ch == 'a'||ch == 'e'||ch == 'i'||ch == 'o'||ch == 'u')){
-        vect.push_back('-');
-        vect.push_back('y');
-        vect.push_back('a');
-        vect.push_back('y');
-        std::string str(vect.begin(), vect.end());
+  };
 
-        return str;
+  constexpr CharTable TABLE {};
 
-    }else if(word.find_first_of(vows) <= 100){
-        
-        /*
-        std::cout<<"word is " << word <<std::endl;
-        std::cout<<"vector is: ";
-        for(char ch : vect){
-            //std::cout<<ch;
-        }
-        std::cout<<"\n"; */
-        char ch = vect[0];
-        while(!(ch == 'a'||ch == 'e'||ch == 'i'||ch == 'o'||ch == 'u'||ch == 'y'||ch == 'A')||ch == 'E'||ch == 'I'||ch == 'O'||ch == 'U'){
-                //std::cout<<"ch is:"<<vect[0]<<std::endl;
-                char temp = vect[0];
-                //std::cout<<"vector before erase is: ";
-             /* for(char ch : vect){
-                   std::cout<<ch;
-                }
-                std::cout<<"\n"; */
-                vect.erase(vect.begin());
-                vect.push_back(temp);
-                //std::cout<<"vector after erase is: ";
-            /*  for(char ch : vect){
-                std::cout<<ch;
-                }
-                std::cout<<"\n";   */
-                ch = vect[0];
-        }
-      
-        vect.push_back('-');
-        vect.push_back('a');
-        vect.push_back('y');
-        std::string str(vect.begin(), vect.end());
-       // std::cout<<str<<std::endl;
-        
-        if(upper == true){
-            for(size_t i = 0; i<str.size(); i++){
-            if(str[i]>=65 && str[i]<=90){
-                str[i]+=32;
-            }
-          }
-            str[0]-=32;
-        }
+  inline unsigned char flags_of(char ch)
+  {
+    return TABLE.flags[static_cast<unsigned char>(ch)];
+  }
+
+#if defined(Q_PIGLATIN_SSE2)
+  // one bit per byte of c that is in aeiouyAEIOUY; or-ing 0x20 folds
+  // the case, and only the upper and lower case vowels fold to one
+  inline int vowel_mask(__m128i c)
+  {
+    __m128i folded = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i m = _mm_cmpeq_epi8(folded, _mm_set1_epi8('a'));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(folded, _mm_set1_epi8('e')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(folded, _mm_set1_epi8('i')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(folded, _mm_set1_epi8('o')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(folded, _mm_set1_epi8('u')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(folded, _mm_set1_epi8('y')));
+    return _mm_movemask_epi8(m);
+  }
 
-        return str;
-        /*
-        std::cout<<"word is " << word <<std::endl;
-        int i = 0;
-        for(char ch : vect){
-            if(ch == 'a'||ch == 'e'||ch == 'i'||ch == 'o'||ch == 'u'||ch == 'y'){
-                std::cout<<"break cond is:"<<vect[i]<<std::endl;
-                break;
-            }else{
-                std::cout<<"else is:"<<vect[i]<<std::endl;
-                char temp = vect[i];
-                vect.erase(vect.begin()+i);
-                vect.push_back(temp);
-            }
-            i++;
-        
-        }
-        vect.push_back('-');
-        vect.push_back('a');
-        vect.push_back('y');
-        std::string str(vect.begin(), vect.end());
-        return str; */
-    }else{
-        vect.push_back('-');
-        vect.push_back('w');
-        vect.push_back('a');
-        vect.push_back('y');
-        std::string str(vect.begin(), vect.end());
-        return str;
+  // one bit per byte of c that is in aeiouyA
+  inline int stop_mask(__m128i c)
+  {
+    __m128i m = _mm_cmpeq_epi8(c, _mm_set1_epi8('a'));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('e')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('i')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('o')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('u')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('y')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(c, _mm_set1_epi8('A')));
+    return _mm_movemask_epi8(m);
+  }
+#endif
+
+  // index of the first character of word at or after from in the class
+  // (VOWEL or STOP), or word.size() if there is none; 16 characters at a
+  // time with SSE2 while a whole block is left, then one at a time
+  std::size_t find_class(std::string_view word, std::size_t from, unsigned char cls)
+  {
+    std::size_t i = from;
+#if defined(Q_PIGLATIN_SSE2)
+    for (; i + 16 <= word.size(); i += 16)
+    {
+      __m128i c = _mm_loadu_si128(reinterpret_cast<__m128i const*>(word.data() + i));
+      int mask = (cls == VOWEL) ? vowel_mask(c) : stop_mask(c);
+      if (mask != 0)
+      {
+        return i + static_cast<std::size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+      }
+    }
+#endif
+    while (i < word.size() && !(flags_of(word[i]) & cls))
+    {
+      i++;
     }
-    //copy range1,range2,to
-    //std::copy(word.begin(), word.end(), vect.begin());
-    /*for(int i = 0; i<vect.size()-1; i++){
-        char ch = vect[i];
-        if(!(ch == 'a'||ch == 'e'||ch == 'i'||ch == 'o'||ch == 'u')){
-            char temp;
-            temp = vect[i];
-            vect.erase(vect.begin()+i);
-            vect.push_back(temp);
-        }
-    }*/
+    return i;
+  }
 
-    //std::find(vect.begin(), vect.end(), "aeiou");
-    //if start vowel -> add suffix -yay
-    //if start (not vowel) OR cont (non vowel) ->  trabsfter cont to end of string
-    //if no vowels -> return word
-    //if Y is first word -> cons else -> vowel
-    //captialise 1st letter of word then return
-    
-    return word;
+  inline char *append(char *out, char const *text, std::size_t len)
+  {
+    std::memcpy(out, text, len);
+    return out + len;
+  }
+}
+
+namespace hlp2
+{
+/*!*************************************************************************
+****
+\brief
+Writes the Pig Latin of a word to out, which needs room for
+word.size() + PIGLATIN_SUFFIX_MAX characters; nothing is allocated.
+A word starting with a vowel takes "-yay". A word with a vowel (y
+included) in its first 101 characters has the letters before its first
+aeiouy or 'A' moved to the end and takes "-ay"; a capitalized word is
+then lower-cased and its new first letter capitalized. Any other word
+takes "-way". A word whose only vowels are E, I, O, U or Y after the
+first letter cannot be rotated to a stop letter, so it also takes
+"-way".
+\param word
+The English word
+\param out
+Where the translation is written; not null-terminated
+\return
+Length of the translation
+****************************************************************************
+***/
+  std::size_t to_piglatin(std::string_view word, char *out)
+  {
+    std::size_t const len = word.size();
+    unsigned char const first = len ? flags_of(word[0]) : 0;
+    if (first & LEADING)
+    {
+      return static_cast<std::size_t>(append(append(out, word.data(), len), "-yay", 4) - out);
+    }
+
+    std::size_t vowel = find_class(word, 0, VOWEL);
+      // every stop letter is a vowel, so the search starts at the first one
+    std::size_t stop = (vowel <= LAST_VOWEL) ? find_class(word, vowel, STOP) : len;
+    if (stop == len)
+    {
+      return static_cast<std::size_t>(append(append(out, word.data(), len), "-way", 4) - out);
+    }
+
+    char *end = append(out, word.data() + stop, len - stop);
+    end = append(end, word.data(), stop);
+    end = append(end, "-ay", 3);
+    if (first & UPPER)
+    {
+      for (std::size_t i = 0; i < len; i++)
+      {
+        out[i] = static_cast<char>(out[i] | ((flags_of(out[i]) & UPPER) ? 0x20 : 0));
+      }
+      out[0] = static_cast<char>(out[0] - 32);
     }
+    return static_cast<std::size_t>(end - out);
+  }
+
+/*!*************************************************************************
+****
+\brief
+The Pig Latin of a word (see to_piglatin(std::string_view, char*)).
+\param word
+The English word
+\return
+The translation
+****************************************************************************
+***/
+  std::string to_piglatin(std::string_view word)
+  {
+    std::string result(word.size() + PIGLATIN_SUFFIX_MAX, '\0');
+    result.resize(to_piglatin(word, &result[0]));
+    return result;
   }
- 
\ No newline at end of file
+}
@@ -1,10 +1,20 @@
+#ifndef Q_HPP_
+#define Q_HPP_
  #include <iostream> // std::cout
 #include <iomanip>  // std::setw, std::endl 
 #include <string>   // std::string
+#include <string_view> // std::string_view
 #include <fstream>  // std::ifstream
 #include <vector>   // std::vector<std::string>
 #include <iterator> // std::istream_iterato
 
  namespace hlp2{
- std::string to_piglatin(std::string word);
- }
\ No newline at end of file
+ // longest suffix a translation adds ("-yay", "-way")
+ std::size_t const PIGLATIN_SUFFIX_MAX {4};
+
+ std::string to_piglatin(std::string_view word);
+ // writes to out, which needs room for word.size() + PIGLATIN_SUFFIX_MAX
+ // characters, and returns the length written
+ std::size_t to_piglatin(std::string_view word, char *out);
+ }
+#endif